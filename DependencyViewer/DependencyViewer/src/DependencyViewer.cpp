@@ -1,66 +1,89 @@
-#include "gui/com_dlg.cpp"
-#include "gui/common_controls.cpp"
-#include "gui/export_view.cpp"
-#include "gui/file_info_getters.cpp"
-#include "gui/import_export_matcher.cpp"
-#include "gui/import_view.cpp"
-#include "gui/list_view_base.cpp"
-#include "gui/main.cpp"
-#include "gui/main_window.cpp"
-#include "gui/modules_view.cpp"
-#include "gui/processor.cpp"
-#include "gui/processor_impl.cpp"
-#include "gui/settings.cpp"
-#include "gui/smart_dc.cpp"
-#include "gui/smart_menu.cpp"
-#include "gui/splitter_window.cpp"
-#include "gui/test.cpp"
-#include "gui/tree_algos.cpp"
-#include "gui/tree_view.cpp"
-
-#include "nogui/act_ctx.cpp"
-#include "nogui/allocator.cpp"
-#include "nogui/allocator_big.cpp"
-#include "nogui/allocator_malloc.cpp"
-#include "nogui/allocator_small.cpp"
-#include "nogui/array_bool.cpp"
-#include "nogui/assert_my.cpp"
-#include "nogui/com.cpp"
-#include "nogui/dbg_provider.cpp"
-#include "nogui/dbghelp.cpp"
-#include "nogui/dependency_locator.cpp"
-#include "nogui/file_name_provider.cpp"
-#include "nogui/fnv1a.cpp"
-#include "nogui/int_to_string.cpp"
-#include "nogui/known_dlls.cpp"
-#include "nogui/memory_manager.cpp"
-#include "nogui/memory_mapped_file.cpp"
-#include "nogui/my_actctx.cpp"
-#include "nogui/my_string.cpp"
-#include "nogui/my_string_handle.cpp"
-#include "nogui/ole.cpp"
-#include "nogui/pe.cpp"
-#include "nogui/pe2.cpp"
-#include "nogui/pe_getters.cpp"
-#include "nogui/pe_getters_export.cpp"
-#include "nogui/pe_getters_import.cpp"
-#include "nogui/smart_handle.cpp"
-#include "nogui/smart_library.cpp"
-#include "nogui/smart_reg_key.cpp"
-#include "nogui/string_converter.cpp"
-#include "nogui/thread_name.cpp"
-#include "nogui/thread_worker.cpp"
-#include "nogui/unicode.cpp"
-#include "nogui/unique_strings.cpp"
-#include "nogui/utils.cpp"
-#include "nogui/wow.cpp"
-
-#include "nogui/pe/coff.cpp"
-#include "nogui/pe/coff_full.cpp"
-#include "nogui/pe/coff_optional_standard.cpp"
-#include "nogui/pe/coff_optional_windows.cpp"
-#include "nogui/pe/export_table.cpp"
-#include "nogui/pe/import_table.cpp"
-#include "nogui/pe/mz.cpp"
-#include "nogui/pe/pe_util.cpp"
-#include "nogui/pe/resource_table.cpp"
+#include "gui/com_dlg.cpp"
+#include "gui/common_controls.cpp"
+#include "gui/compactor.cpp"
+#include "gui/export_view.cpp"
+#include "gui/file_info_getters.cpp"
+#include "gui/forwarder_resolver.cpp"
+#include "gui/import_export_matcher.cpp"
+#include "gui/import_index.cpp"
+#include "gui/import_view.cpp"
+#include "gui/list_view_base.cpp"
+#include "gui/main.cpp"
+#include "gui/main_window.cpp"
+#include "gui/module_graph.cpp"
+#include "gui/modules_view.cpp"
+#include "gui/processor.cpp"
+#include "gui/processor_impl.cpp"
+#include "gui/settings.cpp"
+#include "gui/smart_dc.cpp"
+#include "gui/smart_menu.cpp"
+#include "gui/splitter_window.cpp"
+#include "gui/test.cpp"
+#include "gui/tree_algos.cpp"
+#include "gui/tree_view.cpp"
+
+#include "nogui/act_ctx.cpp"
+#include "nogui/allocator.cpp"
+#include "nogui/allocator_big.cpp"
+#include "nogui/allocator_malloc.cpp"
+#include "nogui/allocator_small.cpp"
+#include "nogui/api_set.cpp"
+#include "nogui/array_bool.cpp"
+#include "nogui/assert_my.cpp"
+#include "nogui/com.cpp"
+#include "nogui/dbg_provider.cpp"
+#include "nogui/dbghelp.cpp"
+#include "nogui/dependency_cache.cpp"
+#include "nogui/dependency_locator.cpp"
+#include "nogui/directory_index.cpp"
+#include "nogui/directory_watcher.cpp"
+#include "nogui/file_fingerprint.cpp"
+#include "nogui/file_name_provider.cpp"
+#include "nogui/file_prefetcher.cpp"
+#include "nogui/file_system.cpp"
+#include "nogui/fnv1a.cpp"
+#include "nogui/int_to_string.cpp"
+#include "nogui/known_dlls.cpp"
+#include "nogui/memory_file_system.cpp"
+#include "nogui/memory_manager.cpp"
+#include "nogui/memory_mapped_file.cpp"
+#include "nogui/msvc_demangler.cpp"
+#include "nogui/my_actctx.cpp"
+#include "nogui/my_string.cpp"
+#include "nogui/my_string_handle.cpp"
+#include "nogui/offline_image.cpp"
+#include "nogui/ole.cpp"
+#include "nogui/parallel_for.cpp"
+#include "nogui/path_canonicalizer.cpp"
+#include "nogui/pdb_publics.cpp"
+#include "nogui/pe.cpp"
+#include "nogui/pe2.cpp"
+#include "nogui/pe_getters.cpp"
+#include "nogui/pe_getters_export.cpp"
+#include "nogui/pe_getters_import.cpp"
+#include "nogui/registry_hive.cpp"
+#include "nogui/search_plan.cpp"
+#include "nogui/smart_handle.cpp"
+#include "nogui/smart_library.cpp"
+#include "nogui/smart_reg_key.cpp"
+#include "nogui/string_converter.cpp"
+#include "nogui/sxs_catalog.cpp"
+#include "nogui/sxs_manifest.cpp"
+#include "nogui/symbol_cache.cpp"
+#include "nogui/thread_name.cpp"
+#include "nogui/thread_worker.cpp"
+#include "nogui/unicode.cpp"
+#include "nogui/unique_strings.cpp"
+#include "nogui/utils.cpp"
+#include "nogui/wow.cpp"
+
+#include "nogui/pe/coff.cpp"
+#include "nogui/pe/coff_full.cpp"
+#include "nogui/pe/coff_optional_standard.cpp"
+#include "nogui/pe/coff_optional_windows.cpp"
+#include "nogui/pe/debug_table.cpp"
+#include "nogui/pe/export_table.cpp"
+#include "nogui/pe/import_table.cpp"
+#include "nogui/pe/mz.cpp"
+#include "nogui/pe/pe_util.cpp"
+#include "nogui/pe/resource_table.cpp"
@@ -0,0 +1,674 @@
+#include "compactor.h"
+
+#include "tree_algos.h"
+
+#include "../nogui/array_bool.h"
+#include "../nogui/cassert_my.h"
+#include "../nogui/pe_getters.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+struct compactor_block
+{
+	file_info const* m_old;
+	std::uint32_t m_count;
+	std::uint32_t m_new;
+};
+
+struct compactor_string_entry
+{
+	std::uint32_t m_offset;
+	std::uint32_t m_idx;
+};
+
+template<typename char_t>
+struct compactor_string_pool
+{
+	std::unordered_map<std::basic_string_view<char_t>, compactor_string_entry> m_entries;
+	std::uint32_t m_base;
+	std::uint32_t m_size;
+};
+
+struct compactor_state
+{
+	std::vector<compactor_block> m_blocks;
+	std::vector<file_info const*> m_files;
+	compactor_string_pool<char> m_strs;
+	compactor_string_pool<wchar_t> m_wstrs;
+	std::byte* m_data;
+	std::uint32_t m_pos;
+};
+
+struct compactor_image_view
+{
+	std::byte* m_data;
+	file_info* m_files;
+	string const* m_strs;
+	wstring const* m_wstrs;
+};
+
+
+static void compactor_layout(main_type const& mo, compactor_state& cs);
+static std::uint32_t compactor_remap(file_info const* const fi, compactor_state const& cs);
+static std::uint32_t compactor_link(file_info const* const fi, compactor_state const& cs);
+static std::uint32_t compactor_reserve(std::uint32_t const size, compactor_state& cs);
+template<typename T> static void compactor_store(T const& obj, std::uint32_t const offset, compactor_state& cs);
+template<typename T> static std::uint32_t compactor_put_array(T const* const src, int const count, compactor_state& cs);
+static std::uint32_t compactor_put_string(string_handle const& str, compactor_state& cs);
+static std::uint32_t compactor_put_wstring(wstring_handle const& str, compactor_state& cs);
+template<typename char_t> static std::uint32_t compactor_put_pooled_string(basic_string<char_t> const& str, compactor_string_pool<char_t>& pool);
+static std::uint32_t compactor_put_strings(string_handle const* const src, int const count, compactor_state& cs);
+static void compactor_put_files(compactor_state& cs);
+static void compactor_put_file(std::uint32_t const idx, std::uint32_t const files_offset, compactor_state& cs);
+static std::uint32_t compactor_put_import_table(pe_import_table_info const& src, compactor_state& cs);
+static std::uint32_t compactor_put_export_table(pe_export_table_info const& src, compactor_state& cs);
+template<typename char_t> static std::uint32_t compactor_string_record_size(std::uint32_t const len);
+template<typename char_t> static void compactor_put_string_pool(compactor_string_pool<char_t> const& pool, compactor_state& cs);
+static file_info* compactor_inflate(session_image const& image, memory_manager& mm);
+template<typename char_t> static basic_string<char_t>* compactor_inflate_strings(std::byte const* const data, std::uint32_t const offset, std::uint32_t const size, std::uint32_t const count, basic_unique_strings<char_t>& strs, allocator& alc);
+static void compactor_inflate_import_table(session_image_import_table const& src, compactor_image_view const& iv, pe_import_table_info* const dst, allocator& alc);
+static void compactor_inflate_export_table(session_image_export_table const& src, compactor_image_view const& iv, pe_export_table_info* const dst, allocator& alc);
+template<typename T> static T* compactor_image_ptr(compactor_image_view const& iv, std::uint32_t const offset);
+static string_handle compactor_image_string(compactor_image_view const& iv, std::uint32_t const offset);
+static string_handle* compactor_image_strings(compactor_image_view const& iv, std::uint32_t const offset, int const count, allocator& alc);
+static file_info* compactor_image_file(compactor_image_view const& iv, std::uint32_t const link);
+static string_handle compactor_copy_string(string_handle const& str, memory_manager& mm);
+static array_bool compactor_copy_array_bool(array_bool const& arr, int const count, allocator& alc);
+template<typename T> static T* compactor_copy_array(T const* const src, int const count, allocator& alc);
+
+
+void compact(main_type& mo)
+{
+	assert(mo.m_fi);
+	compactor_state cs;
+	cs.m_strs.m_base = 0;
+	cs.m_strs.m_size = 0;
+	cs.m_wstrs.m_base = 0;
+	cs.m_wstrs.m_size = 0;
+	compactor_layout(mo, cs);
+	std::uint32_t const file_count = static_cast<std::uint32_t>(cs.m_files.size());
+	std::uint32_t const files_offset = sizeof(session_image_header);
+	std::uint32_t const files_end = files_offset + file_count * static_cast<std::uint32_t>(sizeof(session_image_file));
+
+	// The first pass only measures the tables and collects the strings, the second one writes them.
+	cs.m_data = nullptr;
+	cs.m_pos = files_end;
+	compactor_put_files(cs);
+	std::uint32_t const tables_end = cs.m_pos;
+	cs.m_strs.m_base = (tables_end + 3u) &~ 3u;
+	cs.m_wstrs.m_base = cs.m_strs.m_base + cs.m_strs.m_size;
+	std::uint32_t const size = cs.m_wstrs.m_base + cs.m_wstrs.m_size;
+
+	memory_manager mm;
+	std::byte* const data = static_cast<std::byte*>(mm.m_alc.allocate_bytes(static_cast<int>(size), alignof(session_image_header)));
+	std::memset(data, 0, size);
+	cs.m_data = data;
+	cs.m_pos = files_end;
+	compactor_put_files(cs);
+	assert(cs.m_pos == tables_end);
+	compactor_put_string_pool(cs.m_strs, cs);
+	compactor_put_string_pool(cs.m_wstrs, cs);
+	session_image_header header;
+	header.m_size = size;
+	header.m_file_count = file_count;
+	header.m_files = files_offset;
+	header.m_string_count = static_cast<std::uint32_t>(cs.m_strs.m_entries.size());
+	header.m_strings = cs.m_strs.m_base;
+	header.m_strings_size = cs.m_strs.m_size;
+	header.m_wstring_count = static_cast<std::uint32_t>(cs.m_wstrs.m_entries.size());
+	header.m_wstrings = cs.m_wstrs.m_base;
+	header.m_wstrings_size = cs.m_wstrs.m_size;
+	compactor_store(header, 0, cs);
+
+	session_image const image{data, static_cast<int>(size)};
+	file_info* const files = compactor_inflate(image, mm);
+	tree_order const& order = mo.m_tree_order;
+	file_info** const tree_list = mm.m_alc.allocate_objects<file_info*>(order.m_count);
+	std::transform(order.m_list, order.m_list + order.m_count, tree_list, [&](file_info const* const& fi){ return files + compactor_remap(fi, cs); });
+	std::uint16_t const n = mo.m_modules_list.m_count;
+	file_info** const modules_list = mm.m_alc.allocate_objects<file_info*>(n);
+	std::transform(mo.m_modules_list.m_list, mo.m_modules_list.m_list + n, modules_list, [&](file_info const* const& fi){ return files + compactor_remap(fi, cs); });
+	mo.m_image = image;
+	mo.m_fi = files;
+	mo.m_tree_order.m_list = tree_list;
+	mo.m_modules_list.m_list = modules_list;
+	mo.m_mm.swap(mm);
+}
+
+void snapshot(main_type const& mo, session_snapshot* const snapshot_out)
+{
+	assert(snapshot_out);
+	assert(mo.m_image.m_data);
+	snapshot_out->m_image.assign(mo.m_image.m_data, mo.m_image.m_data + mo.m_image.m_size);
+	std::uint16_t const n = mo.m_modules_list.m_count;
+	snapshot_out->m_modules.resize(n);
+	std::transform(mo.m_modules_list.m_list, mo.m_modules_list.m_list + n, snapshot_out->m_modules.begin(), [&](file_info const* const& fi){ return static_cast<std::uint32_t>(fi - mo.m_fi); });
+	snapshot_out->m_fingerprints.assign(mo.m_fingerprints, mo.m_fingerprints + n);
+}
+
+void inflate_snapshot(session_snapshot& snapshot, main_type& mo)
+{
+	assert(!snapshot.m_image.empty());
+	session_image const image{snapshot.m_image.data(), static_cast<int>(snapshot.m_image.size())};
+	file_info* const files = compactor_inflate(image, mo.m_mm);
+	std::uint16_t const n = static_cast<std::uint16_t>(snapshot.m_modules.size());
+	file_info** const modules_list = mo.m_mm.m_alc.allocate_objects<file_info*>(n);
+	std::transform(snapshot.m_modules.begin(), snapshot.m_modules.end(), modules_list, [&](std::uint32_t const& idx){ return files + idx; });
+	module_fingerprint* const fingerprints = mo.m_mm.m_alc.allocate_objects<module_fingerprint>(n);
+	std::copy(snapshot.m_fingerprints.begin(), snapshot.m_fingerprints.end(), fingerprints);
+	mo.m_image = image;
+	mo.m_fi = files;
+	mo.m_modules_list.m_list = modules_list;
+	mo.m_modules_list.m_count = n;
+	mo.m_fingerprints = fingerprints;
+}
+
+
+void compactor_layout(main_type const& mo, compactor_state& cs)
+{
+	// Root first, then each node's children as one contiguous block, blocks in depth first order of their parents.
+	static constexpr auto const add_children = [](file_info const& fi, compactor_state& cs)
+	{
+		std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+		if(n == 0)
+		{
+			return;
+		}
+		std::uint32_t const first = static_cast<std::uint32_t>(cs.m_files.size());
+		cs.m_blocks.push_back(compactor_block{fi.m_fis, n, first});
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			cs.m_files.push_back(&fi.m_fis[i]);
+		}
+	};
+	tree_order const& order = mo.m_tree_order;
+	cs.m_files.reserve(order.m_count + 1);
+	cs.m_files.push_back(mo.m_fi);
+	cs.m_blocks.push_back(compactor_block{mo.m_fi, 1, 0});
+	add_children(*mo.m_fi, cs);
+	for(std::uint32_t i = 0; i != order.m_count; ++i)
+	{
+		add_children(*order.m_list[i], cs);
+	}
+	assert(cs.m_files.size() == order.m_count + 1);
+	std::sort(cs.m_blocks.begin(), cs.m_blocks.end(), [](compactor_block const& a, compactor_block const& b){ return std::less<file_info const*>{}(a.m_old, b.m_old); });
+}
+
+std::uint32_t compactor_remap(file_info const* const fi, compactor_state const& cs)
+{
+	assert(fi);
+	auto const it = std::upper_bound(cs.m_blocks.begin(), cs.m_blocks.end(), fi, [](file_info const* const& a, compactor_block const& b){ return std::less<file_info const*>{}(a, b.m_old); });
+	assert(it != cs.m_blocks.begin());
+	compactor_block const& block = *std::prev(it);
+	assert(fi >= block.m_old && fi < block.m_old + block.m_count);
+	return block.m_new + static_cast<std::uint32_t>(fi - block.m_old);
+}
+
+std::uint32_t compactor_link(file_info const* const fi, compactor_state const& cs)
+{
+	return fi ? compactor_remap(fi, cs) + 1 : 0;
+}
+
+std::uint32_t compactor_reserve(std::uint32_t const size, compactor_state& cs)
+{
+	std::uint32_t const offset = (cs.m_pos + 3u) &~ 3u;
+	cs.m_pos = offset + size;
+	return offset;
+}
+
+template<typename T>
+void compactor_store(T const& obj, std::uint32_t const offset, compactor_state& cs)
+{
+	if(!cs.m_data)
+	{
+		return;
+	}
+	std::memcpy(cs.m_data + offset, &obj, sizeof(obj));
+}
+
+template<typename T>
+std::uint32_t compactor_put_array(T const* const src, int const count, compactor_state& cs)
+{
+	static_assert(alignof(T) <= 4);
+	if(!src)
+	{
+		return 0;
+	}
+	std::uint32_t const offset = compactor_reserve(count * static_cast<std::uint32_t>(sizeof(T)), cs);
+	if(cs.m_data)
+	{
+		std::memcpy(cs.m_data + offset, src, count * sizeof(T));
+	}
+	return offset;
+}
+
+std::uint32_t compactor_put_string(string_handle const& str, compactor_state& cs)
+{
+	if(!str.m_string)
+	{
+		return 0;
+	}
+	if(str.m_string == get_name_undecorating().m_string)
+	{
+		return 1;
+	}
+	if(str.m_string == get_export_name_processing().m_string)
+	{
+		return 2;
+	}
+	return compactor_put_pooled_string(*str.m_string, cs.m_strs);
+}
+
+std::uint32_t compactor_put_wstring(wstring_handle const& str, compactor_state& cs)
+{
+	if(!str.m_string)
+	{
+		return 0;
+	}
+	return compactor_put_pooled_string(*str.m_string, cs.m_wstrs);
+}
+
+template<typename char_t>
+std::uint32_t compactor_put_pooled_string(basic_string<char_t> const& str, compactor_string_pool<char_t>& pool)
+{
+	std::basic_string_view<char_t> const key{str.m_str, static_cast<std::size_t>(str.m_len)};
+	auto const itb = pool.m_entries.try_emplace(key, compactor_string_entry{pool.m_size, static_cast<std::uint32_t>(pool.m_entries.size())});
+	if(itb.second)
+	{
+		pool.m_size += compactor_string_record_size<char_t>(static_cast<std::uint32_t>(str.m_len));
+	}
+	return pool.m_base + itb.first->second.m_offset;
+}
+
+std::uint32_t compactor_put_strings(string_handle const* const src, int const count, compactor_state& cs)
+{
+	if(!src)
+	{
+		return 0;
+	}
+	std::uint32_t const offset = compactor_reserve(count * static_cast<std::uint32_t>(sizeof(std::uint32_t)), cs);
+	for(int i = 0; i != count; ++i)
+	{
+		std::uint32_t const str = compactor_put_string(src[i], cs);
+		compactor_store(str, offset + i * static_cast<std::uint32_t>(sizeof(std::uint32_t)), cs);
+	}
+	return offset;
+}
+
+void compactor_put_files(compactor_state& cs)
+{
+	std::uint32_t const n = static_cast<std::uint32_t>(cs.m_files.size());
+	for(std::uint32_t i = 0; i != n; ++i)
+	{
+		compactor_put_file(i, sizeof(session_image_header), cs);
+	}
+}
+
+void compactor_put_file(std::uint32_t const idx, std::uint32_t const files_offset, compactor_state& cs)
+{
+	file_info const& src = *cs.m_files[idx];
+	std::uint16_t const n = src.m_import_table.m_normal_dll_count + src.m_import_table.m_delay_dll_count;
+	session_image_file dst{};
+	if(cs.m_data)
+	{
+		dst.m_fis = n != 0 ? compactor_link(src.m_fis, cs) : 0;
+		dst.m_parent = compactor_link(src.m_parent, cs);
+		dst.m_orig_instance = compactor_link(src.m_orig_instance, cs);
+		dst.m_prev_instance = compactor_link(src.m_prev_instance, cs);
+		dst.m_next_instance = compactor_link(src.m_next_instance, cs);
+	}
+	dst.m_file_path = compactor_put_wstring(src.m_file_path, cs);
+	dst.m_import_table = compactor_put_import_table(src.m_import_table, cs);
+	dst.m_export_table = compactor_put_export_table(src.m_export_table, cs);
+	dst.m_time_date_stamp = src.m_time_date_stamp;
+	dst.m_image_size = src.m_image_size;
+	std::copy(std::cbegin(src.m_pdb_guid), std::cend(src.m_pdb_guid), dst.m_pdb_guid);
+	dst.m_pdb_age = src.m_pdb_age;
+	dst.m_is_32_bit = src.m_is_32_bit ? 1 : 0;
+	dst.m_is_deferred = src.m_is_deferred ? 1 : 0;
+	compactor_store(dst, files_offset + idx * static_cast<std::uint32_t>(sizeof(session_image_file)), cs);
+}
+
+std::uint32_t compactor_put_import_table(pe_import_table_info const& src, compactor_state& cs)
+{
+	std::uint16_t const n = src.m_normal_dll_count + src.m_delay_dll_count;
+	std::uint32_t const offset = compactor_reserve(sizeof(session_image_import_table), cs);
+	session_image_import_table dst{};
+	dst.m_normal_dll_count = src.m_normal_dll_count;
+	dst.m_delay_dll_count = src.m_delay_dll_count;
+	dst.m_dll_names = compactor_put_strings(src.m_dll_names, n, cs);
+	dst.m_import_counts = compactor_put_array(src.m_import_counts, n, cs);
+	if(src.m_are_ordinals)
+	{
+		dst.m_dlls = compactor_reserve(n * static_cast<std::uint32_t>(sizeof(session_image_import_dll)), cs);
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			std::uint16_t const m = src.m_import_counts[i];
+			session_image_import_dll dll;
+			dll.m_are_ordinals = compactor_put_array(src.m_are_ordinals[i].m_data, array_bool_space_needed(m), cs);
+			dll.m_ordinals_or_hints = compactor_put_array(src.m_ordinals_or_hints[i], m, cs);
+			dll.m_names = compactor_put_strings(src.m_names[i], m, cs);
+			dll.m_undecorated_names = compactor_put_strings(src.m_undecorated_names[i], m, cs);
+			dll.m_matched_exports = compactor_put_array(src.m_matched_exports[i], m, cs);
+			compactor_store(dll, dst.m_dlls + i * static_cast<std::uint32_t>(sizeof(session_image_import_dll)), cs);
+		}
+	}
+	compactor_store(dst, offset, cs);
+	return offset;
+}
+
+std::uint32_t compactor_put_export_table(pe_export_table_info const& src, compactor_state& cs)
+{
+	std::uint16_t const n = src.m_count;
+	std::uint32_t const offset = compactor_reserve(sizeof(session_image_export_table), cs);
+	session_image_export_table dst{};
+	dst.m_count = n;
+	dst.m_ordinal_base = src.m_ordinal_base;
+	if(n != 0)
+	{
+		int const bits = array_bool_space_needed(n);
+		dst.m_ordinals = compactor_put_array(src.m_ordinals, n, cs);
+		dst.m_are_rvas = compactor_put_array(src.m_are_rvas.m_data, bits, cs);
+		dst.m_rvas_or_forwarders = compactor_reserve(n * static_cast<std::uint32_t>(sizeof(std::uint32_t)), cs);
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			std::uint32_t const rva_or_forwarder = array_bool_tst(src.m_are_rvas, i) ? src.m_rvas_or_forwarders[i].m_rva : compactor_put_string(src.m_rvas_or_forwarders[i].m_forwarder, cs);
+			compactor_store(rva_or_forwarder, dst.m_rvas_or_forwarders + i * static_cast<std::uint32_t>(sizeof(std::uint32_t)), cs);
+		}
+		dst.m_hints = compactor_put_array(src.m_hints, n, cs);
+		dst.m_names = compactor_put_strings(src.m_names, n, cs);
+		dst.m_undecorated_names = compactor_put_strings(src.m_undecorated_names, n, cs);
+		dst.m_are_used = compactor_put_array(src.m_are_used.m_data, bits, cs);
+		dst.m_forwarder_targets = compactor_put_array(src.m_forwarder_targets, n, cs);
+	}
+	compactor_store(dst, offset, cs);
+	return offset;
+}
+
+template<typename char_t>
+std::uint32_t compactor_string_record_size(std::uint32_t const len)
+{
+	std::uint32_t const size = static_cast<std::uint32_t>(sizeof(session_image_string)) + (len + 1) * static_cast<std::uint32_t>(sizeof(char_t));
+	return (size + 3u) &~ 3u;
+}
+
+template<typename char_t>
+void compactor_put_string_pool(compactor_string_pool<char_t> const& pool, compactor_state& cs)
+{
+	assert(cs.m_data);
+	for(auto const& entry : pool.m_entries)
+	{
+		std::uint32_t const offset = pool.m_base + entry.second.m_offset;
+		session_image_string const record{entry.second.m_idx, static_cast<std::uint32_t>(entry.first.size())};
+		compactor_store(record, offset, cs);
+		std::memcpy(cs.m_data + offset + sizeof(session_image_string), entry.first.data(), entry.first.size() * sizeof(char_t));
+	}
+}
+
+file_info* compactor_inflate(session_image const& image, memory_manager& mm)
+{
+	assert(image.m_data);
+	session_image_header const& header = *reinterpret_cast<session_image_header const*>(image.m_data);
+	assert(header.m_size == static_cast<std::uint32_t>(image.m_size));
+	compactor_image_view iv;
+	iv.m_data = image.m_data;
+	iv.m_files = mm.m_alc.allocate_objects<file_info>(header.m_file_count);
+	init(iv.m_files, header.m_file_count);
+	iv.m_strs = compactor_inflate_strings<char>(image.m_data, header.m_strings, header.m_strings_size, header.m_string_count, mm.m_strs, mm.m_alc);
+	iv.m_wstrs = compactor_inflate_strings<wchar_t>(image.m_data, header.m_wstrings, header.m_wstrings_size, header.m_wstring_count, mm.m_wstrs, mm.m_alc);
+	session_image_file const* const srcs = reinterpret_cast<session_image_file const*>(image.m_data + header.m_files);
+	for(std::uint32_t i = 0; i != header.m_file_count; ++i)
+	{
+		session_image_file const& src = srcs[i];
+		file_info& dst = iv.m_files[i];
+		dst.m_fis = compactor_image_file(iv, src.m_fis);
+		dst.m_parent = compactor_image_file(iv, src.m_parent);
+		dst.m_orig_instance = compactor_image_file(iv, src.m_orig_instance);
+		dst.m_prev_instance = compactor_image_file(iv, src.m_prev_instance);
+		dst.m_next_instance = compactor_image_file(iv, src.m_next_instance);
+		dst.m_file_path = wstring_handle{src.m_file_path != 0 ? &iv.m_wstrs[reinterpret_cast<session_image_string const*>(image.m_data + src.m_file_path)->m_idx] : nullptr};
+		compactor_inflate_import_table(*reinterpret_cast<session_image_import_table const*>(image.m_data + src.m_import_table), iv, &dst.m_import_table, mm.m_alc);
+		compactor_inflate_export_table(*reinterpret_cast<session_image_export_table const*>(image.m_data + src.m_export_table), iv, &dst.m_export_table, mm.m_alc);
+		dst.m_time_date_stamp = src.m_time_date_stamp;
+		dst.m_image_size = src.m_image_size;
+		std::copy(std::cbegin(src.m_pdb_guid), std::cend(src.m_pdb_guid), dst.m_pdb_guid);
+		dst.m_pdb_age = src.m_pdb_age;
+		dst.m_is_32_bit = src.m_is_32_bit != 0;
+		dst.m_is_deferred = src.m_is_deferred != 0;
+	}
+	return iv.m_files;
+}
+
+template<typename char_t>
+basic_string<char_t>* compactor_inflate_strings(std::byte const* const data, std::uint32_t const offset, std::uint32_t const size, std::uint32_t const count, basic_unique_strings<char_t>& unique_strs, allocator& alc)
+{
+	basic_string<char_t>* const strs = alc.allocate_objects<basic_string<char_t>>(count);
+	unique_strs.reserve(static_cast<int>(count));
+	for(std::uint32_t pos = offset; pos != offset + size;)
+	{
+		assert(pos < offset + size);
+		session_image_string const& record = *reinterpret_cast<session_image_string const*>(data + pos);
+		assert(record.m_idx < count);
+		strs[record.m_idx].m_str = reinterpret_cast<char_t const*>(data + pos + sizeof(session_image_string));
+		strs[record.m_idx].m_len = static_cast<int>(record.m_len);
+		// The pool is deduplicated already, registering its strings keeps later add_string calls returning the very same records.
+		unique_strs.add_external_string(&strs[record.m_idx]);
+		pos += compactor_string_record_size<char_t>(record.m_len);
+	}
+	return strs;
+}
+
+void compactor_inflate_import_table(session_image_import_table const& src, compactor_image_view const& iv, pe_import_table_info* const dst, allocator& alc)
+{
+	assert(dst);
+	std::uint16_t const n = src.m_normal_dll_count + src.m_delay_dll_count;
+	dst->m_normal_dll_count = src.m_normal_dll_count;
+	dst->m_delay_dll_count = src.m_delay_dll_count;
+	dst->m_dll_names = compactor_image_strings(iv, src.m_dll_names, n, alc);
+	dst->m_import_counts = compactor_image_ptr<std::uint16_t const>(iv, src.m_import_counts);
+	if(src.m_dlls == 0)
+	{
+		return;
+	}
+	session_image_import_dll const* const dlls = compactor_image_ptr<session_image_import_dll const>(iv, src.m_dlls);
+	array_bool* const are_ordinals_all = alc.allocate_objects<array_bool>(n);
+	std::uint16_t const** const ordinals_or_hints_all = alc.allocate_objects<std::uint16_t const*>(n);
+	string_handle const** const names_all = alc.allocate_objects<string_handle const*>(n);
+	string_handle** const undecorated_names_all = alc.allocate_objects<string_handle*>(n);
+	std::uint16_t** const matched_exports_all = alc.allocate_objects<std::uint16_t*>(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		std::uint16_t const m = dst->m_import_counts[i];
+		session_image_import_dll const& dll = dlls[i];
+		are_ordinals_all[i] = array_bool{compactor_image_ptr<unsigned>(iv, dll.m_are_ordinals)};
+		ordinals_or_hints_all[i] = compactor_image_ptr<std::uint16_t const>(iv, dll.m_ordinals_or_hints);
+		names_all[i] = compactor_image_strings(iv, dll.m_names, m, alc);
+		undecorated_names_all[i] = compactor_image_strings(iv, dll.m_undecorated_names, m, alc);
+		matched_exports_all[i] = compactor_image_ptr<std::uint16_t>(iv, dll.m_matched_exports);
+	}
+	dst->m_are_ordinals = are_ordinals_all;
+	dst->m_ordinals_or_hints = ordinals_or_hints_all;
+	dst->m_names = names_all;
+	dst->m_undecorated_names = undecorated_names_all;
+	dst->m_matched_exports = matched_exports_all;
+}
+
+void compactor_inflate_export_table(session_image_export_table const& src, compactor_image_view const& iv, pe_export_table_info* const dst, allocator& alc)
+{
+	assert(dst);
+	std::uint16_t const n = src.m_count;
+	dst->m_count = n;
+	dst->m_ordinal_base = src.m_ordinal_base;
+	if(n == 0)
+	{
+		return;
+	}
+	dst->m_ordinals = compactor_image_ptr<std::uint16_t const>(iv, src.m_ordinals);
+	dst->m_are_rvas = array_bool{compactor_image_ptr<unsigned>(iv, src.m_are_rvas)};
+	std::uint32_t const* const rvas_or_forwarders_src = compactor_image_ptr<std::uint32_t const>(iv, src.m_rvas_or_forwarders);
+	pe_rva_or_forwarder* const rvas_or_forwarders = alc.allocate_objects<pe_rva_or_forwarder>(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		if(array_bool_tst(dst->m_are_rvas, i))
+		{
+			rvas_or_forwarders[i].m_rva = rvas_or_forwarders_src[i];
+		}
+		else
+		{
+			rvas_or_forwarders[i].m_forwarder = compactor_image_string(iv, rvas_or_forwarders_src[i]);
+		}
+	}
+	dst->m_rvas_or_forwarders = rvas_or_forwarders;
+	dst->m_hints = compactor_image_ptr<std::uint16_t const>(iv, src.m_hints);
+	dst->m_names = compactor_image_strings(iv, src.m_names, n, alc);
+	dst->m_undecorated_names = compactor_image_strings(iv, src.m_undecorated_names, n, alc);
+	dst->m_are_used = array_bool{compactor_image_ptr<unsigned>(iv, src.m_are_used)};
+	dst->m_forwarder_targets = compactor_image_ptr<pe_export_forwarder_target>(iv, src.m_forwarder_targets);
+}
+
+template<typename T>
+T* compactor_image_ptr(compactor_image_view const& iv, std::uint32_t const offset)
+{
+	return offset != 0 ? reinterpret_cast<T*>(iv.m_data + offset) : nullptr;
+}
+
+string_handle compactor_image_string(compactor_image_view const& iv, std::uint32_t const offset)
+{
+	switch(offset)
+	{
+		case 0: return string_handle{nullptr};
+		case 1: return get_name_undecorating();
+		case 2: return get_export_name_processing();
+	}
+	session_image_string const& record = *reinterpret_cast<session_image_string const*>(iv.m_data + offset);
+	return string_handle{&iv.m_strs[record.m_idx]};
+}
+
+string_handle* compactor_image_strings(compactor_image_view const& iv, std::uint32_t const offset, int const count, allocator& alc)
+{
+	if(offset == 0)
+	{
+		return nullptr;
+	}
+	std::uint32_t const* const src = compactor_image_ptr<std::uint32_t const>(iv, offset);
+	string_handle* const dst = alc.allocate_objects<string_handle>(count);
+	std::transform(src, src + count, dst, [&](std::uint32_t const& e){ return compactor_image_string(iv, e); });
+	return dst;
+}
+
+file_info* compactor_image_file(compactor_image_view const& iv, std::uint32_t const link)
+{
+	return link != 0 ? iv.m_files + (link - 1) : nullptr;
+}
+
+
+void compactor_copy_import_table(pe_import_table_info const& src, pe_import_table_info* const dst, memory_manager& mm)
+{
+	assert(dst);
+	std::uint16_t const n = src.m_normal_dll_count + src.m_delay_dll_count;
+	dst->m_normal_dll_count = src.m_normal_dll_count;
+	dst->m_delay_dll_count = src.m_delay_dll_count;
+	if(src.m_dll_names)
+	{
+		string_handle* const dll_names = mm.m_alc.allocate_objects<string_handle>(n);
+		std::transform(src.m_dll_names, src.m_dll_names + n, dll_names, [&](string_handle const& e){ return compactor_copy_string(e, mm); });
+		dst->m_dll_names = dll_names;
+	}
+	dst->m_import_counts = compactor_copy_array(src.m_import_counts, n, mm.m_alc);
+	if(!src.m_are_ordinals)
+	{
+		return;
+	}
+	array_bool* const are_ordinals_all = mm.m_alc.allocate_objects<array_bool>(n);
+	std::uint16_t** const ordinals_or_hints_all = mm.m_alc.allocate_objects<std::uint16_t*>(n);
+	string_handle** const names_all = mm.m_alc.allocate_objects<string_handle*>(n);
+	string_handle** const undecorated_names_all = mm.m_alc.allocate_objects<string_handle*>(n);
+	std::uint16_t** const matched_exports_all = mm.m_alc.allocate_objects<std::uint16_t*>(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		std::uint16_t const m = src.m_import_counts[i];
+		are_ordinals_all[i] = compactor_copy_array_bool(src.m_are_ordinals[i], m, mm.m_alc);
+		ordinals_or_hints_all[i] = compactor_copy_array(src.m_ordinals_or_hints[i], m, mm.m_alc);
+		names_all[i] = mm.m_alc.allocate_objects<string_handle>(m);
+		std::transform(src.m_names[i], src.m_names[i] + m, names_all[i], [&](string_handle const& e){ return compactor_copy_string(e, mm); });
+		undecorated_names_all[i] = mm.m_alc.allocate_objects<string_handle>(m);
+		std::transform(src.m_undecorated_names[i], src.m_undecorated_names[i] + m, undecorated_names_all[i], [&](string_handle const& e){ return compactor_copy_string(e, mm); });
+		matched_exports_all[i] = compactor_copy_array(src.m_matched_exports[i], m, mm.m_alc);
+	}
+	dst->m_are_ordinals = are_ordinals_all;
+	dst->m_ordinals_or_hints = ordinals_or_hints_all;
+	dst->m_names = names_all;
+	dst->m_undecorated_names = undecorated_names_all;
+	dst->m_matched_exports = matched_exports_all;
+}
+
+void compactor_copy_export_table(pe_export_table_info const& src, pe_export_table_info* const dst, memory_manager& mm)
+{
+	assert(dst);
+	std::uint16_t const n = src.m_count;
+	dst->m_count = n;
+	dst->m_ordinal_base = src.m_ordinal_base;
+	if(n == 0)
+	{
+		return;
+	}
+	dst->m_ordinals = compactor_copy_array(src.m_ordinals, n, mm.m_alc);
+	dst->m_are_rvas = compactor_copy_array_bool(src.m_are_rvas, n, mm.m_alc);
+	pe_rva_or_forwarder* const rvas_or_forwarders = mm.m_alc.allocate_objects<pe_rva_or_forwarder>(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		if(array_bool_tst(src.m_are_rvas, i))
+		{
+			rvas_or_forwarders[i].m_rva = src.m_rvas_or_forwarders[i].m_rva;
+		}
+		else
+		{
+			rvas_or_forwarders[i].m_forwarder = compactor_copy_string(src.m_rvas_or_forwarders[i].m_forwarder, mm);
+		}
+	}
+	dst->m_rvas_or_forwarders = rvas_or_forwarders;
+	dst->m_hints = compactor_copy_array(src.m_hints, n, mm.m_alc);
+	dst->m_names = mm.m_alc.allocate_objects<string_handle>(n);
+	std::transform(src.m_names, src.m_names + n, dst->m_names, [&](string_handle const& e){ return compactor_copy_string(e, mm); });
+	dst->m_undecorated_names = mm.m_alc.allocate_objects<string_handle>(n);
+	std::transform(src.m_undecorated_names, src.m_undecorated_names + n, dst->m_undecorated_names, [&](string_handle const& e){ return compactor_copy_string(e, mm); });
+	dst->m_are_used = compactor_copy_array_bool(src.m_are_used, n, mm.m_alc);
+	dst->m_forwarder_targets = src.m_forwarder_targets ? compactor_copy_array(src.m_forwarder_targets, n, mm.m_alc) : nullptr;
+}
+
+string_handle compactor_copy_string(string_handle const& str, memory_manager& mm)
+{
+	bool const is_sentinel = !str.m_string || str.m_string == get_name_undecorating().m_string || str.m_string == get_export_name_processing().m_string;
+	if(is_sentinel)
+	{
+		return str;
+	}
+	return mm.m_strs.add_string(str.m_string->m_str, str.m_string->m_len, mm.m_alc);
+}
+
+array_bool compactor_copy_array_bool(array_bool const& arr, int const count, allocator& alc)
+{
+	int const bits_to_dwords = array_bool_space_needed(count);
+	return array_bool{compactor_copy_array(arr.m_data, bits_to_dwords, alc)};
+}
+
+template<typename T>
+T* compactor_copy_array(T const* const src, int const count, allocator& alc)
+{
+	if(!src)
+	{
+		return nullptr;
+	}
+	T* const dst = alc.allocate_objects<T>(count);
+	std::copy(src, src + count, dst);
+	return dst;
+}
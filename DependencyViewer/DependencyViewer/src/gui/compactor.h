@@ -0,0 +1,87 @@
+#pragma once
+
+
+#include "processor.h"
+
+#include <cstdint>
+
+
+// Session image, one contiguous pointer-free block. Every reference is a byte offset from the start of the image (0 means none) or a file index + 1 (0 means none).
+
+struct session_image_header
+{
+	std::uint32_t m_size;
+	std::uint32_t m_file_count;
+	std::uint32_t m_files;
+	std::uint32_t m_string_count;
+	std::uint32_t m_strings;
+	std::uint32_t m_strings_size;
+	std::uint32_t m_wstring_count;
+	std::uint32_t m_wstrings;
+	std::uint32_t m_wstrings_size;
+};
+
+struct session_image_file
+{
+	std::uint32_t m_fis;
+	std::uint32_t m_parent;
+	std::uint32_t m_orig_instance;
+	std::uint32_t m_prev_instance;
+	std::uint32_t m_next_instance;
+	std::uint32_t m_file_path;
+	std::uint32_t m_import_table;
+	std::uint32_t m_export_table;
+	std::uint32_t m_time_date_stamp;
+	std::uint32_t m_image_size;
+	std::uint8_t m_pdb_guid[16];
+	std::uint32_t m_pdb_age;
+	std::uint8_t m_is_32_bit;
+	std::uint8_t m_is_deferred;
+	std::uint8_t m_reserved[2];
+};
+
+struct session_image_import_table
+{
+	std::uint16_t m_normal_dll_count;
+	std::uint16_t m_delay_dll_count;
+	std::uint32_t m_dll_names;
+	std::uint32_t m_import_counts;
+	std::uint32_t m_dlls;
+};
+
+struct session_image_import_dll
+{
+	std::uint32_t m_are_ordinals;
+	std::uint32_t m_ordinals_or_hints;
+	std::uint32_t m_names;
+	std::uint32_t m_undecorated_names;
+	std::uint32_t m_matched_exports;
+};
+
+struct session_image_export_table
+{
+	std::uint16_t m_count;
+	std::uint16_t m_ordinal_base;
+	std::uint32_t m_ordinals;
+	std::uint32_t m_are_rvas;
+	std::uint32_t m_rvas_or_forwarders;
+	std::uint32_t m_hints;
+	std::uint32_t m_names;
+	std::uint32_t m_undecorated_names;
+	std::uint32_t m_are_used;
+	std::uint32_t m_forwarder_targets;
+};
+
+// Followed by m_len + 1 characters, padded to 4 bytes. String offsets 1 and 2 stand for the name undecorating and export name processing sentinels.
+struct session_image_string
+{
+	std::uint32_t m_idx;
+	std::uint32_t m_len;
+};
+
+
+void compact(main_type& mo);
+void snapshot(main_type const& mo, session_snapshot* const snapshot_out);
+void inflate_snapshot(session_snapshot& snapshot, main_type& mo);
+void compactor_copy_import_table(pe_import_table_info const& src, pe_import_table_info* const dst, memory_manager& mm);
+void compactor_copy_export_table(pe_export_table_info const& src, pe_export_table_info* const dst, memory_manager& mm);
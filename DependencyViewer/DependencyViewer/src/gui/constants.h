@@ -1,16 +1,16 @@
-#pragma once
-
-
-#include <cstdint>
-
-
-static constexpr std::uint16_t const s_main_view_menu_min = 10000;
-static constexpr std::uint16_t const s_main_view_menu_max = 10100;
-static constexpr std::uint16_t const s_tree_view_menu_min = 10100;
-static constexpr std::uint16_t const s_tree_view_menu_max = 10200;
-static constexpr std::uint16_t const s_modules_view_menu_min = 10200;
-static constexpr std::uint16_t const s_modules_view_menu_max = 10300;
-static constexpr std::uint16_t const s_import_view_menu_min = 10300;
-static constexpr std::uint16_t const s_import_view_menu_max = 10400;
-static constexpr std::uint16_t const s_export_view_menu_min = 10400;
-static constexpr std::uint16_t const s_export_view_menu_max = 10500;
+#pragma once
+
+
+#include <cstdint>
+
+
+static constexpr std::uint16_t const s_main_view_menu_min = 10000;
+static constexpr std::uint16_t const s_main_view_menu_max = 10100;
+static constexpr std::uint16_t const s_tree_view_menu_min = 10100;
+static constexpr std::uint16_t const s_tree_view_menu_max = 10200;
+static constexpr std::uint16_t const s_modules_view_menu_min = 10200;
+static constexpr std::uint16_t const s_modules_view_menu_max = 10300;
+static constexpr std::uint16_t const s_import_view_menu_min = 10300;
+static constexpr std::uint16_t const s_import_view_menu_max = 10400;
+static constexpr std::uint16_t const s_export_view_menu_min = 10400;
+static constexpr std::uint16_t const s_export_view_menu_max = 10500;
@@ -1,54 +1,85 @@
-#include "file_info_getters.h"
-
-#include "processor.h"
-
-#include "../nogui/cassert_my.h"
-
-#include <cstdint>
-
-
-string_handle const& get_dll_name_no_path(file_info const* const& fi)
-{
-	assert(fi);
-	assert(!fi->m_file_path);
-	assert(fi->m_parent);
-	file_info const* const parent_fi = fi->m_parent;
-	auto const dll_idx_ = fi - parent_fi->m_fis;
-	assert(dll_idx_ >= 0 && dll_idx_ <= 0xFFFF);
-	auto const dll_idx = static_cast<std::uint16_t>(dll_idx_);
-	assert(dll_idx < parent_fi->m_import_table.m_normal_dll_count + parent_fi->m_import_table.m_delay_dll_count);
-	auto const& dll_name = parent_fi->m_import_table.m_dll_names[dll_idx];
-	assert(dll_name);
-	return dll_name;
-};
-
-bool compare_fi_by_path_or_name(file_info const* const& a, file_info const* const& b)
-{
-	assert(a);
-	assert(b);
-	assert(!a->m_orig_instance);
-	assert(!b->m_orig_instance);
-	auto const& path_a = a->m_file_path;
-	auto const& path_b = b->m_file_path;
-	if(path_a && path_b)
-	{
-		auto const ret = wstring_handle_case_insensitive_less{}(path_a, path_b);
-		return ret;
-	}
-	else if(!path_a && !path_b)
-	{
-		auto const& dll_name_a = get_dll_name_no_path(a);
-		auto const& dll_name_b = get_dll_name_no_path(b);
-		auto const ret = string_handle_case_insensitive_less{}(dll_name_a, dll_name_b);
-		return ret;
-	}
-	else if(path_a && !path_b)
-	{
-		return false;
-	}
-	else
-	{
-		assert(!path_a && path_b);
-		return true;
-	}
-};
+#include "file_info_getters.h"
+
+#include "processor.h"
+
+#include "../nogui/cassert_my.h"
+
+#include <algorithm>
+#include <cstdint>
+
+
+string_handle const& get_dll_name_no_path(file_info const* const& fi)
+{
+	assert(fi);
+	assert(!fi->m_file_path);
+	assert(fi->m_parent);
+	file_info const* const parent_fi = fi->m_parent;
+	auto const dll_idx_ = fi - parent_fi->m_fis;
+	assert(dll_idx_ >= 0 && dll_idx_ <= 0xFFFF);
+	auto const dll_idx = static_cast<std::uint16_t>(dll_idx_);
+	assert(dll_idx < parent_fi->m_import_table.m_normal_dll_count + parent_fi->m_import_table.m_delay_dll_count);
+	auto const& dll_name = parent_fi->m_import_table.m_dll_names[dll_idx];
+	assert(dll_name);
+	return dll_name;
+};
+
+bool compare_fi_by_path_or_name(file_info const* const& a, file_info const* const& b)
+{
+	assert(a);
+	assert(b);
+	assert(!a->m_orig_instance);
+	assert(!b->m_orig_instance);
+	auto const& path_a = a->m_file_path;
+	auto const& path_b = b->m_file_path;
+	if(path_a && path_b)
+	{
+		auto const ret = wstring_handle_case_insensitive_less{}(path_a, path_b);
+		return ret;
+	}
+	else if(!path_a && !path_b)
+	{
+		auto const& dll_name_a = get_dll_name_no_path(a);
+		auto const& dll_name_b = get_dll_name_no_path(b);
+		auto const ret = string_handle_case_insensitive_less{}(dll_name_a, dll_name_b);
+		return ret;
+	}
+	else if(path_a && !path_b)
+	{
+		return false;
+	}
+	else
+	{
+		assert(!path_a && path_b);
+		return true;
+	}
+};
+
+void get_matched_imports(file_info const* const& fi, std::vector<std::uint16_t>* const matched_imports_out)
+{
+	assert(fi);
+	assert(matched_imports_out);
+	std::vector<std::uint16_t>& matched_imports = *matched_imports_out;
+	file_info const& fi_proper = fi->m_orig_instance ? *fi->m_orig_instance : *fi;
+	matched_imports.resize(fi_proper.m_export_table.m_count);
+	std::fill(matched_imports.begin(), matched_imports.end(), static_cast<std::uint16_t>(0xFFFF));
+	file_info const* const parent_fi = fi->m_parent;
+	if(!parent_fi || !fi_proper.m_file_path)
+	{
+		return;
+	}
+	auto const dll_idx_ = fi - parent_fi->m_fis;
+	assert(dll_idx_ >= 0 && dll_idx_ <= 0xFFFF);
+	auto const dll_idx = static_cast<std::uint16_t>(dll_idx_);
+	assert(dll_idx < parent_fi->m_import_table.m_normal_dll_count + parent_fi->m_import_table.m_delay_dll_count);
+	std::uint16_t const n_imports = parent_fi->m_import_table.m_import_counts[dll_idx];
+	for(std::uint16_t i = 0; i != n_imports; ++i)
+	{
+		std::uint16_t const& matched_export = parent_fi->m_import_table.m_matched_exports[dll_idx][i];
+		if(matched_export == 0xFFFF)
+		{
+			continue;
+		}
+		assert(matched_export < matched_imports.size());
+		matched_imports[matched_export] = i;
+	}
+}
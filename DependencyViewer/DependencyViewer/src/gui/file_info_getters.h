@@ -1,11 +1,15 @@
-#pragma once
-
-
-#include "../nogui/my_string_handle.h"
-
-
-struct file_info;
-
-
-string_handle const& get_dll_name_no_path(file_info const* const& fi);
-bool compare_fi_by_path_or_name(file_info const* const& a, file_info const* const& b);
+#pragma once
+
+
+#include "../nogui/my_string_handle.h"
+
+#include <cstdint>
+#include <vector>
+
+
+struct file_info;
+
+
+string_handle const& get_dll_name_no_path(file_info const* const& fi);
+bool compare_fi_by_path_or_name(file_info const* const& a, file_info const* const& b);
+void get_matched_imports(file_info const* const& fi, std::vector<std::uint16_t>* const matched_imports_out);
@@ -0,0 +1,282 @@
+#include "forwarder_resolver.h"
+
+#include "processor.h"
+#include "processor_impl.h"
+
+#include "../nogui/api_set.h"
+#include "../nogui/array_bool.h"
+#include "../nogui/cassert_my.h"
+#include "../nogui/pe.h"
+#include "../nogui/search_plan.h"
+#include "../nogui/unicode.h"
+#include "../nogui/utils.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+static constexpr std::uint16_t const s_forwarder_unresolved = 0xFFFF;
+static constexpr std::uint16_t const s_forwarder_in_progress = 0xFFFE;
+static constexpr std::uint16_t const s_forwarder_ambiguous = 0xFFFD;
+
+
+typedef std::pair<std::uint16_t, string const*> forwarder_resolver_memo_key;
+
+struct forwarder_resolver_memo_key_hash
+{
+	std::size_t operator()(forwarder_resolver_memo_key const& obj) const { return std::hash<string const*>{}(obj.second) ^ (static_cast<std::size_t>(obj.first) * 0x9E37'79B9u); }
+};
+
+struct forwarder_resolver_state
+{
+	modules_list_t const* m_modules_list;
+	api_set_schema const* m_api_set;
+	std::vector<enptr_type> m_enpts;
+	std::unordered_map<std::string, std::uint16_t> m_modules;
+	std::unordered_map<wstring_handle, std::uint16_t> m_paths;
+	std::unordered_map<forwarder_resolver_memo_key, pe_export_forwarder_target, forwarder_resolver_memo_key_hash> m_memo;
+	std::vector<forwarder_resolver_memo_key> m_chain;
+	std::string m_module_name;
+	int m_hits;
+	int m_misses;
+};
+
+
+static pe_export_forwarder_target forwarder_resolver_resolve(std::uint16_t const module_idx, string_handle const& forwarder, forwarder_resolver_state& frs);
+static pe_export_forwarder_target forwarder_resolver_hop(std::uint16_t const module_idx, string_handle const& forwarder, forwarder_resolver_state& frs);
+static std::uint16_t forwarder_resolver_find_module(std::uint16_t const module_idx, std::string_view const module_name, forwarder_resolver_state& frs);
+static std::uint16_t forwarder_resolver_find_dependency(std::uint16_t const module_idx, std::string const& dll_name, forwarder_resolver_state const& frs);
+static std::uint16_t forwarder_resolver_find_export(std::uint16_t const module_idx, std::string_view const function_name, forwarder_resolver_state const& frs);
+
+
+void resolve_forwarders(modules_list_t const& modules_list, tmp_type& to)
+{
+	forwarder_resolver_state frs;
+	frs.m_modules_list = &modules_list;
+	frs.m_api_set = to.m_plan.m_api_set;
+	frs.m_enpts.resize(modules_list.m_count, enptr_type{nullptr, 0});
+	frs.m_hits = 0;
+	frs.m_misses = 0;
+	std::string name;
+	for(std::uint16_t i = 0; i != modules_list.m_count; ++i)
+	{
+		file_info* const module = modules_list.m_list[i];
+		if(!module->m_file_path || module->m_export_table.m_count == 0)
+		{
+			continue;
+		}
+		fat_type tmp;
+		tmp.m_instance = module;
+		auto const it = to.m_map.find(&tmp);
+		assert(it != to.m_map.end());
+		frs.m_enpts[i] = (*it)->m_enpt;
+		frs.m_paths.emplace(module->m_file_path, i);
+		wchar_t const* const file_name = find_file_name(cbegin(module->m_file_path), size(module->m_file_path));
+		int const file_name_len = static_cast<int>(cend(module->m_file_path) - file_name);
+		if(!is_ascii(file_name, file_name_len))
+		{
+			continue;
+		}
+		name.resize(file_name_len);
+		std::transform(file_name, file_name + file_name_len, name.begin(), [](wchar_t const& ch){ return static_cast<char>(to_lowercase(ch)); });
+		auto const itb = frs.m_modules.emplace(name, i);
+		if(!itb.second)
+		{
+			itb.first->second = s_forwarder_ambiguous;
+		}
+	}
+	for(std::uint16_t i = 0; i != modules_list.m_count; ++i)
+	{
+		pe_export_table_info& eti = modules_list.m_list[i]->m_export_table;
+		std::uint16_t const n = eti.m_count;
+		bool has_forwarders = false;
+		for(std::uint16_t j = 0; j != n && !has_forwarders; ++j)
+		{
+			has_forwarders = !array_bool_tst(eti.m_are_rvas, j);
+		}
+		if(!has_forwarders)
+		{
+			continue;
+		}
+		if(!eti.m_forwarder_targets)
+		{
+			eti.m_forwarder_targets = to.m_mm->m_alc.allocate_objects<pe_export_forwarder_target>(n);
+		}
+		for(std::uint16_t j = 0; j != n; ++j)
+		{
+			bool const is_rva = array_bool_tst(eti.m_are_rvas, j);
+			eti.m_forwarder_targets[j] = is_rva ? pe_export_forwarder_target{s_forwarder_unresolved, s_forwarder_unresolved} : forwarder_resolver_resolve(i, eti.m_rvas_or_forwarders[j].m_forwarder, frs);
+		}
+	}
+	to.m_mo->m_stats.m_forwarder_memo_hits = frs.m_hits;
+	to.m_mo->m_stats.m_forwarder_memo_misses = frs.m_misses;
+}
+
+
+pe_export_forwarder_target forwarder_resolver_resolve(std::uint16_t const module_idx, string_handle const& forwarder, forwarder_resolver_state& frs)
+{
+	// The same forwarder string may lead elsewhere from a different module, memoize per forwarding module.
+	frs.m_chain.clear();
+	pe_export_forwarder_target ret{s_forwarder_unresolved, s_forwarder_unresolved};
+	forwarder_resolver_memo_key current{module_idx, forwarder.m_string};
+	for(;;)
+	{
+		auto const it = frs.m_memo.find(current);
+		if(it != frs.m_memo.end())
+		{
+			++frs.m_hits;
+			ret = it->second.m_module == s_forwarder_in_progress ? pe_export_forwarder_target{s_forwarder_unresolved, s_forwarder_unresolved} : it->second;
+			break;
+		}
+		++frs.m_misses;
+		frs.m_memo.emplace(current, pe_export_forwarder_target{s_forwarder_in_progress, s_forwarder_in_progress});
+		frs.m_chain.push_back(current);
+		pe_export_forwarder_target const hop = forwarder_resolver_hop(current.first, string_handle{current.second}, frs);
+		if(hop.m_module == s_forwarder_unresolved)
+		{
+			break;
+		}
+		pe_export_table_info const& eti = frs.m_modules_list->m_list[hop.m_module]->m_export_table;
+		if(array_bool_tst(eti.m_are_rvas, hop.m_export))
+		{
+			ret = hop;
+			break;
+		}
+		current = forwarder_resolver_memo_key{hop.m_module, eti.m_rvas_or_forwarders[hop.m_export].m_forwarder.m_string};
+	}
+	for(forwarder_resolver_memo_key const& e : frs.m_chain)
+	{
+		frs.m_memo[e] = ret;
+	}
+	return ret;
+}
+
+pe_export_forwarder_target forwarder_resolver_hop(std::uint16_t const module_idx, string_handle const& forwarder, forwarder_resolver_state& frs)
+{
+	static constexpr pe_export_forwarder_target const s_unresolved{s_forwarder_unresolved, s_forwarder_unresolved};
+	std::string_view const fwd{cbegin(forwarder), static_cast<std::size_t>(size(forwarder))};
+	std::size_t const dot = fwd.rfind('.');
+	if(dot == std::string_view::npos || dot == 0 || dot + 1 == fwd.size())
+	{
+		return s_unresolved;
+	}
+	std::uint16_t const target_idx = forwarder_resolver_find_module(module_idx, fwd.substr(0, dot), frs);
+	if(target_idx == s_forwarder_unresolved)
+	{
+		return s_unresolved;
+	}
+	std::uint16_t const export_idx = forwarder_resolver_find_export(target_idx, fwd.substr(dot + 1), frs);
+	if(export_idx == s_forwarder_unresolved)
+	{
+		return s_unresolved;
+	}
+	return pe_export_forwarder_target{target_idx, export_idx};
+}
+
+std::uint16_t forwarder_resolver_find_module(std::uint16_t const module_idx, std::string_view const module_name, forwarder_resolver_state& frs)
+{
+	// Prefer the module the forwarding module itself was located against, as the loader would, fall back to a unique file name.
+	std::string& name = frs.m_module_name;
+	name.resize(module_name.size());
+	std::transform(module_name.begin(), module_name.end(), name.begin(), [](char const& ch){ return to_lowercase(ch); });
+	if(name.find('.') == std::string::npos)
+	{
+		name.append(".dll");
+	}
+	std::uint16_t const dependency_idx = forwarder_resolver_find_dependency(module_idx, name, frs);
+	if(dependency_idx != s_forwarder_unresolved)
+	{
+		return dependency_idx;
+	}
+	if(frs.m_api_set)
+	{
+		string host;
+		bool const is_api_set = frs.m_api_set->resolve(string{name.c_str(), static_cast<int>(name.size())}, &host);
+		if(is_api_set)
+		{
+			if(!host)
+			{
+				return s_forwarder_unresolved;
+			}
+			name.assign(host.m_str, host.m_len);
+			std::uint16_t const host_idx = forwarder_resolver_find_dependency(module_idx, name, frs);
+			if(host_idx != s_forwarder_unresolved)
+			{
+				return host_idx;
+			}
+		}
+	}
+	auto const it = frs.m_modules.find(name);
+	if(it == frs.m_modules.end() || it->second == s_forwarder_ambiguous)
+	{
+		return s_forwarder_unresolved;
+	}
+	return it->second;
+}
+
+std::uint16_t forwarder_resolver_find_dependency(std::uint16_t const module_idx, std::string const& dll_name, forwarder_resolver_state const& frs)
+{
+	file_info const& fi = *frs.m_modules_list->m_list[module_idx];
+	pe_import_table_info const& iti = fi.m_import_table;
+	if(!fi.m_fis)
+	{
+		return s_forwarder_unresolved;
+	}
+	string const name{dll_name.c_str(), static_cast<int>(dll_name.size())};
+	std::uint16_t const n = iti.m_normal_dll_count + iti.m_delay_dll_count;
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		wstring_handle const& path = fi.m_fis[i].m_file_path;
+		if(!path || !string_case_insensitive_equal{}(*iti.m_dll_names[i].m_string, name))
+		{
+			continue;
+		}
+		auto const it = frs.m_paths.find(path);
+		if(it != frs.m_paths.end())
+		{
+			return it->second;
+		}
+	}
+	return s_forwarder_unresolved;
+}
+
+std::uint16_t forwarder_resolver_find_export(std::uint16_t const module_idx, std::string_view const function_name, forwarder_resolver_state const& frs)
+{
+	pe_export_table_info const& eti = frs.m_modules_list->m_list[module_idx]->m_export_table;
+	if(function_name[0] == '#')
+	{
+		std::uint32_t ordinal = 0;
+		for(char const& ch : function_name.substr(1))
+		{
+			if(ch < '0' || ch > '9' || ordinal > 0xFFFF)
+			{
+				return s_forwarder_unresolved;
+			}
+			ordinal = ordinal * 10 + static_cast<std::uint32_t>(ch - '0');
+		}
+		if(function_name.size() == 1 || ordinal > 0xFFFF)
+		{
+			return s_forwarder_unresolved;
+		}
+		auto const ordinals_end = eti.m_ordinals + eti.m_count;
+		auto const it = std::lower_bound(eti.m_ordinals, ordinals_end, static_cast<std::uint16_t>(ordinal));
+		if(it == ordinals_end || *it != ordinal)
+		{
+			return s_forwarder_unresolved;
+		}
+		return static_cast<std::uint16_t>(it - eti.m_ordinals);
+	}
+	enptr_type const& enpt = frs.m_enpts[module_idx];
+	auto const enpt_end = enpt.m_table + enpt.m_count;
+	auto const fn_name = [&](std::uint16_t const& exp_idx){ string_handle const& e = eti.m_names[exp_idx]; return std::string_view{cbegin(e), static_cast<std::size_t>(size(e))}; };
+	auto const it = std::lower_bound(enpt.m_table, enpt_end, function_name, [&](std::uint16_t const& e, std::string_view const& v){ return fn_name(e) < v; });
+	if(it == enpt_end || fn_name(*it) != function_name)
+	{
+		return s_forwarder_unresolved;
+	}
+	return *it;
+}
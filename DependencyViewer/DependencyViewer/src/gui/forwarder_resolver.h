@@ -0,0 +1,11 @@
+#pragma once
+
+
+#include <cstdint>
+
+
+struct modules_list_t;
+struct tmp_type;
+
+
+void resolve_forwarders(modules_list_t const& modules_list, tmp_type& to);
@@ -0,0 +1,83 @@
+#include "import_index.h"
+
+#include "module_graph.h"
+#include "processor.h"
+
+#include "../nogui/cassert_my.h"
+
+#include <algorithm>
+#include <vector>
+
+
+template<typename fn_t> static void import_index_for_each(modules_list_t const& modules_list, module_graph const& graph, std::uint32_t const* const bases, fn_t const& fn);
+
+
+void make_import_index(modules_list_t const& modules_list, module_graph const& graph, allocator& alc, import_index* const index_out)
+{
+	assert(index_out);
+	import_index& index = *index_out;
+	std::uint16_t const n = modules_list.m_count;
+	assert(graph.m_count == n);
+	std::uint32_t* const bases = alc.allocate_objects<std::uint32_t>(n + 1);
+	bases[0] = 0;
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		bases[i + 1] = bases[i] + modules_list.m_list[i]->m_export_table.m_count;
+	}
+	std::uint32_t const total = bases[n];
+	std::uint32_t* const offsets = alc.allocate_objects<std::uint32_t>(total + 1);
+	std::fill(offsets, offsets + total + 1, std::uint32_t{0});
+	import_index_for_each(modules_list, graph, bases, [&](std::uint32_t const slot, import_index_entry const&){ ++offsets[slot + 1]; });
+	for(std::uint32_t i = 0; i != total; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+	import_index_entry* const entries = alc.allocate_objects<import_index_entry>(offsets[total]);
+	std::vector<std::uint32_t> cursors(offsets, offsets + total);
+	import_index_for_each(modules_list, graph, bases, [&](std::uint32_t const slot, import_index_entry const& entry){ entries[cursors[slot]++] = entry; });
+	index.m_bases = bases;
+	index.m_offsets = offsets;
+	index.m_entries = entries;
+}
+
+void import_index_find(import_index const& index, std::uint16_t const module_idx, std::uint16_t const exp_idx, import_index_entry const** const begin_out, import_index_entry const** const end_out)
+{
+	assert(begin_out);
+	assert(end_out);
+	std::uint32_t const slot = index.m_bases[module_idx] + exp_idx;
+	assert(slot < index.m_bases[module_idx + 1]);
+	*begin_out = index.m_entries + index.m_offsets[slot];
+	*end_out = index.m_entries + index.m_offsets[slot + 1];
+}
+
+
+template<typename fn_t>
+void import_index_for_each(modules_list_t const& modules_list, module_graph const& graph, std::uint32_t const* const bases, fn_t const& fn)
+{
+	std::uint16_t const n = modules_list.m_count;
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		pe_import_table_info const& iti = modules_list.m_list[i]->m_import_table;
+		if(!iti.m_matched_exports)
+		{
+			continue;
+		}
+		std::uint16_t const m = iti.m_normal_dll_count + iti.m_delay_dll_count;
+		for(std::uint16_t j = 0; j != m; ++j)
+		{
+			std::uint16_t const target = graph.m_edges[graph.m_offsets[i] + j];
+			std::uint16_t const exp_count = modules_list.m_list[target]->m_export_table.m_count;
+			std::uint16_t const* const matched_exports = iti.m_matched_exports[j];
+			std::uint16_t const imp_count = iti.m_import_counts[j];
+			for(std::uint16_t k = 0; k != imp_count; ++k)
+			{
+				std::uint16_t const matched_export = matched_exports[k];
+				if(matched_export >= exp_count)
+				{
+					continue;
+				}
+				fn(bases[target] + matched_export, import_index_entry{i, j, k});
+			}
+		}
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+
+#include "../nogui/allocator.h"
+
+#include <cstdint>
+
+
+struct module_graph;
+struct modules_list_t;
+
+
+struct import_index_entry
+{
+	std::uint16_t m_module;
+	std::uint16_t m_dll;
+	std::uint16_t m_import;
+};
+
+struct import_index
+{
+	std::uint32_t* m_bases;
+	std::uint32_t* m_offsets;
+	import_index_entry* m_entries;
+};
+
+
+void make_import_index(modules_list_t const& modules_list, module_graph const& graph, allocator& alc, import_index* const index_out);
+void import_index_find(import_index const& index, std::uint16_t const module_idx, std::uint16_t const exp_idx, import_index_entry const** const begin_out, import_index_entry const** const end_out);
@@ -1,8 +1,8 @@
-#pragma once
-
-
-#include "../nogui/my_windows.h"
-
-
-int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ PWSTR pCmdLine, _In_ int nCmdShow);
-HINSTANCE get_instance();
+#pragma once
+
+
+#include "../nogui/my_windows.h"
+
+
+int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ PWSTR pCmdLine, _In_ int nCmdShow);
+HINSTANCE get_instance();
@@ -0,0 +1,46 @@
+#include "module_graph.h"
+
+#include "file_info_getters.h"
+#include "processor.h"
+
+#include "../nogui/cassert_my.h"
+
+#include <algorithm>
+
+
+void make_module_graph(modules_list_t const& modules_list, allocator& alc, module_graph* const graph_out)
+{
+	assert(graph_out);
+	module_graph& graph = *graph_out;
+	std::uint16_t const n = modules_list.m_count;
+	std::uint32_t* const offsets = alc.allocate_objects<std::uint32_t>(n + 1);
+	offsets[0] = 0;
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		file_info const& fi = *modules_list.m_list[i];
+		offsets[i + 1] = offsets[i] + fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+	}
+	std::uint16_t* const edges = alc.allocate_objects<std::uint16_t>(offsets[n]);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		file_info const& fi = *modules_list.m_list[i];
+		std::uint16_t const m = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+		for(std::uint16_t j = 0; j != m; ++j)
+		{
+			edges[offsets[i] + j] = module_graph_find(modules_list, &fi.m_fis[j]);
+		}
+	}
+	graph.m_count = n;
+	graph.m_offsets = offsets;
+	graph.m_edges = edges;
+}
+
+std::uint16_t module_graph_find(modules_list_t const& modules_list, file_info const* const& fi)
+{
+	assert(fi);
+	file_info const* const fi_proper = fi->m_orig_instance ? fi->m_orig_instance : fi;
+	file_info** const list_end = modules_list.m_list + modules_list.m_count;
+	auto const it = std::lower_bound(modules_list.m_list, list_end, fi_proper, compare_fi_by_path_or_name);
+	assert(it != list_end && !compare_fi_by_path_or_name(fi_proper, *it));
+	return static_cast<std::uint16_t>(it - modules_list.m_list);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+
+#include "../nogui/allocator.h"
+
+#include <cstdint>
+
+
+struct file_info;
+struct modules_list_t;
+
+
+struct module_graph
+{
+	std::uint16_t m_count;
+	std::uint32_t* m_offsets;
+	std::uint16_t* m_edges;
+};
+
+
+void make_module_graph(modules_list_t const& modules_list, allocator& alc, module_graph* const graph_out);
+std::uint16_t module_graph_find(modules_list_t const& modules_list, file_info const* const& fi);
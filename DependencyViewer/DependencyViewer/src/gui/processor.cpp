@@ -1,75 +1,212 @@
-#include "processor.h"
-
-#include "processor_impl.h"
-
-#include "../nogui/assert_my.h"
-#include "../nogui/cassert_my.h"
-
-#include <cstring>
-#include <type_traits>
-#include <utility>
-
-
-template<typename T>
-inline constexpr bool is_simple_type_v =
-	std::is_trivial_v                        	<T> &&
-	std::is_trivially_copyable_v             	<T> &&
-	std::is_standard_layout_v                	<T> &&
-	std::is_pod_v                            	<T> &&
-	std::is_aggregate_v                      	<T> &&
-	std::is_constructible_v                  	<T> &&
-	std::is_trivially_constructible_v        	<T> &&
-	std::is_nothrow_constructible_v          	<T> &&
-	std::is_default_constructible_v          	<T> &&
-	std::is_trivially_default_constructible_v	<T> &&
-	std::is_nothrow_default_constructible_v  	<T> &&
-	std::is_copy_constructible_v             	<T> &&
-	std::is_trivially_copy_constructible_v   	<T> &&
-	std::is_nothrow_copy_constructible_v     	<T> &&
-	std::is_move_constructible_v             	<T> &&
-	std::is_trivially_move_constructible_v   	<T> &&
-	std::is_nothrow_move_constructible_v     	<T> &&
-	std::is_copy_assignable_v                	<T> &&
-	std::is_trivially_copy_assignable_v      	<T> &&
-	std::is_nothrow_copy_assignable_v        	<T> &&
-	std::is_move_assignable_v                	<T> &&
-	std::is_trivially_move_assignable_v      	<T> &&
-	std::is_nothrow_move_assignable_v        	<T> &&
-	std::is_destructible_v                   	<T> &&
-	std::is_trivially_destructible_v         	<T> &&
-	std::is_nothrow_destructible_v           	<T> &&
-	std::is_swappable_v                      	<T> &&
-	std::is_nothrow_swappable_v              	<T>;
-
-
-static_assert(is_simple_type_v<file_info>, "");
-
-
-void init(file_info* const fi)
-{
-	init(fi, 1);
-}
-
-void init(file_info* const fi, int const count)
-{
-	std::memset(fi, 0, count * sizeof(*fi));
-}
-
-void main_type::swap(main_type& other) noexcept
-{
-	using std::swap;
-	swap(m_fi, other.m_fi);
-	swap(m_modules_list, other.m_modules_list);
-	swap(m_mm, other.m_mm);
-}
-
-
-bool process(std::vector<std::wstring> const& file_paths, main_type* const mo_out)
-{
-	assert(mo_out);
-	main_type mo;
-	bool const processed = process_impl(file_paths, mo);
-	WARN_M_R(processed, L"Failed to process_impl.", false);
-	mo_out->swap(mo);
-	return true;
-}
+#include "processor.h"
+
+#include "compactor.h"
+#include "processor_impl.h"
+
+#include "../nogui/assert_my.h"
+#include "../nogui/cassert_my.h"
+#include "../nogui/my_actctx.h"
+#include "../nogui/scope_exit.h"
+#include "../nogui/thread_name.h"
+
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+
+template<typename T>
+inline constexpr bool is_simple_type_v =
+	std::is_trivial_v                        	<T> &&
+	std::is_trivially_copyable_v             	<T> &&
+	std::is_standard_layout_v                	<T> &&
+	std::is_pod_v                            	<T> &&
+	std::is_aggregate_v                      	<T> &&
+	std::is_constructible_v                  	<T> &&
+	std::is_trivially_constructible_v        	<T> &&
+	std::is_nothrow_constructible_v          	<T> &&
+	std::is_default_constructible_v          	<T> &&
+	std::is_trivially_default_constructible_v	<T> &&
+	std::is_nothrow_default_constructible_v  	<T> &&
+	std::is_copy_constructible_v             	<T> &&
+	std::is_trivially_copy_constructible_v   	<T> &&
+	std::is_nothrow_copy_constructible_v     	<T> &&
+	std::is_move_constructible_v             	<T> &&
+	std::is_trivially_move_constructible_v   	<T> &&
+	std::is_nothrow_move_constructible_v     	<T> &&
+	std::is_copy_assignable_v                	<T> &&
+	std::is_trivially_copy_assignable_v      	<T> &&
+	std::is_nothrow_copy_assignable_v        	<T> &&
+	std::is_move_assignable_v                	<T> &&
+	std::is_trivially_move_assignable_v      	<T> &&
+	std::is_nothrow_move_assignable_v        	<T> &&
+	std::is_destructible_v                   	<T> &&
+	std::is_trivially_destructible_v         	<T> &&
+	std::is_nothrow_destructible_v           	<T> &&
+	std::is_swappable_v                      	<T> &&
+	std::is_nothrow_swappable_v              	<T>;
+
+
+static_assert(is_simple_type_v<file_info>, "");
+
+
+void init(file_info* const fi)
+{
+	init(fi, 1);
+}
+
+void init(file_info* const fi, int const count)
+{
+	std::memset(fi, 0, count * sizeof(*fi));
+}
+
+void main_type::swap(main_type& other) noexcept
+{
+	using std::swap;
+	swap(m_image, other.m_image);
+	swap(m_fi, other.m_fi);
+	swap(m_tree_order, other.m_tree_order);
+	swap(m_modules_list, other.m_modules_list);
+	swap(m_stats, other.m_stats);
+	swap(m_graph, other.m_graph);
+	swap(m_importers, other.m_importers);
+	swap(m_fingerprints, other.m_fingerprints);
+	swap(m_undecorations, other.m_undecorations);
+	swap(m_mm, other.m_mm);
+}
+
+
+processor_job::processor_job() :
+	m_thread(),
+	m_file_paths(),
+	m_options(),
+	m_prev(),
+	m_incremental(false),
+	m_progress(),
+	m_mo(),
+	m_processed(false),
+	m_done(false)
+{
+}
+
+processor_job::~processor_job()
+{
+	cancel();
+	wait();
+}
+
+void processor_job::start(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, processor_progress_fn_t const fn, processor_progress_param_t const param)
+{
+	assert(!is_busy());
+	assert(fn);
+	m_file_paths = file_paths;
+	m_options = options;
+	m_incremental = prev && prev->m_fi;
+	if(m_incremental)
+	{
+		snapshot(*prev, &m_prev);
+	}
+	m_progress.m_canceled.store(false);
+	m_progress.m_modules.store(0);
+	m_progress.m_queued.store(0);
+	m_progress.m_bytes_mapped.store(0);
+	m_progress.m_fn = fn;
+	m_progress.m_param = param;
+	m_progress.m_want_tree_records = !m_incremental;
+	m_progress.m_tree_records.clear();
+	m_processed = false;
+	m_done.store(false);
+	my_actctx::deactivate();
+	auto const activate_my_actctx = mk::make_scope_exit([](){ my_actctx::activate(); });
+	m_thread = std::thread([this](){ thread_func(); });
+}
+
+void processor_job::cancel()
+{
+	m_progress.m_canceled.store(true);
+}
+
+void processor_job::wait()
+{
+	if(!m_thread.joinable())
+	{
+		return;
+	}
+	m_thread.join();
+}
+
+bool processor_job::finish(main_type* const mo_out)
+{
+	assert(mo_out);
+	assert(is_busy());
+	wait();
+	if(!m_processed)
+	{
+		return false;
+	}
+	mo_out->swap(m_mo);
+	main_type empty{};
+	m_mo.swap(empty);
+	return true;
+}
+
+bool processor_job::is_busy() const
+{
+	return m_thread.joinable();
+}
+
+bool processor_job::is_done() const
+{
+	return m_done.load();
+}
+
+bool processor_job::is_incremental() const
+{
+	return m_incremental;
+}
+
+processor_progress_t const& processor_job::get_progress() const
+{
+	return m_progress;
+}
+
+void processor_job::take_tree_records(std::vector<processor_tree_record_t>* const records_out)
+{
+	assert(records_out);
+	records_out->clear();
+	std::lock_guard<std::mutex> const lck(m_progress.m_tree_records_mutex);
+	records_out->swap(m_progress.m_tree_records);
+}
+
+void processor_job::thread_func()
+{
+	name_current_thread("processor_job", L"processor_job");
+	main_type prev{};
+	if(m_incremental)
+	{
+		inflate_snapshot(m_prev, prev);
+	}
+	main_type mo{};
+	bool const processed = process_impl(m_file_paths, m_options, m_incremental ? &prev : nullptr, &m_progress, mo);
+	m_prev = session_snapshot{};
+	if(processed)
+	{
+		m_mo.swap(mo);
+	}
+	m_processed = processed;
+	m_done.store(true);
+	m_progress.m_fn(m_progress.m_param);
+}
+
+
+bool process(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, main_type* const mo_out)
+{
+	assert(mo_out);
+	my_actctx::deactivate();
+	auto const activate_my_actctx = mk::make_scope_exit([](){ my_actctx::activate(); });
+	main_type mo;
+	bool const processed = process_impl(file_paths, options, prev, nullptr, mo);
+	WARN_M_R(processed, L"Failed to process_impl.", false);
+	mo_out->swap(mo);
+	return true;
+}
@@ -1,48 +1,176 @@
-#pragma once
-
-#include "../nogui/memory_manager.h"
-#include "../nogui/my_string_handle.h"
-#include "../nogui/pe.h"
-
-#include <cstdint>
-
-
-struct htreeitem_s;
-typedef htreeitem_s* htreeitem;
-
-
-struct file_info
-{
-	htreeitem m_tree_item;
-	file_info* m_fis;
-	file_info* m_parent;
-	file_info* m_orig_instance;
-	file_info* m_prev_instance;
-	file_info* m_next_instance;
-	wstring_handle m_file_path;
-	pe_import_table_info m_import_table;
-	pe_export_table_info m_export_table;
-	std::uint16_t* m_matched_imports;
-	std::uint8_t m_icon;
-	bool m_is_32_bit;
-};
-void init(file_info* const fi);
-void init(file_info* const fi, int const count);
-
-struct modules_list_t
-{
-	file_info** m_list;
-	std::uint16_t m_count;
-};
-
-struct main_type
-{
-	file_info* m_fi;
-	modules_list_t m_modules_list;
-	memory_manager m_mm;
-	void swap(main_type& other) noexcept;
-};
-inline void swap(main_type& a, main_type& b) noexcept { a.swap(b); }
-
-
-bool process(std::vector<std::wstring> const& file_paths, main_type* const mo_out);
+#pragma once
+
+#include "import_index.h"
+#include "module_graph.h"
+#include "tree_algos.h"
+
+#include "../nogui/file_fingerprint.h"
+#include "../nogui/memory_manager.h"
+#include "../nogui/my_string_handle.h"
+#include "../nogui/pe.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+struct htreeitem_s;
+typedef htreeitem_s* htreeitem;
+
+
+struct file_info
+{
+	htreeitem m_tree_item;
+	file_info* m_fis;
+	file_info* m_parent;
+	file_info* m_orig_instance;
+	file_info* m_prev_instance;
+	file_info* m_next_instance;
+	wstring_handle m_file_path;
+	pe_import_table_info m_import_table;
+	pe_export_table_info m_export_table;
+	std::uint32_t m_time_date_stamp;
+	std::uint32_t m_image_size;
+	std::uint8_t m_pdb_guid[16];
+	std::uint32_t m_pdb_age;
+	std::uint8_t m_icon;
+	bool m_is_32_bit;
+	bool m_is_deferred;
+};
+void init(file_info* const fi);
+void init(file_info* const fi, int const count);
+
+struct modules_list_t
+{
+	file_info** m_list;
+	std::uint16_t m_count;
+};
+
+struct processor_stats_t
+{
+	int m_dependency_cache_hits;
+	int m_dependency_cache_misses;
+	int m_forwarder_memo_hits;
+	int m_forwarder_memo_misses;
+	int m_undecoration_memo_hits;
+	int m_undecoration_memo_misses;
+};
+
+struct undecoration_memo_entry_t
+{
+	string_handle m_undecorated;
+	std::vector<string_handle*> m_waiters;
+};
+
+struct module_fingerprint
+{
+	file_fingerprint m_file;
+	std::uint32_t m_manifest_id;
+};
+
+struct session_image
+{
+	std::byte* m_data;
+	int m_size;
+};
+
+struct session_snapshot
+{
+	std::vector<std::byte> m_image;
+	std::vector<std::uint32_t> m_modules;
+	std::vector<module_fingerprint> m_fingerprints;
+};
+
+struct main_type
+{
+	session_image m_image;
+	file_info* m_fi;
+	tree_order m_tree_order;
+	modules_list_t m_modules_list;
+	processor_stats_t m_stats;
+	module_graph m_graph;
+	import_index m_importers;
+	module_fingerprint* m_fingerprints;
+	std::unordered_map<string const*, undecoration_memo_entry_t> m_undecorations;
+	memory_manager m_mm;
+	void swap(main_type& other) noexcept;
+};
+inline void swap(main_type& a, main_type& b) noexcept { a.swap(b); }
+
+struct processor_options_t
+{
+	std::uint16_t m_depth;
+	std::vector<std::wstring> m_expanded;
+	std::wstring m_winsxs;
+	std::wstring m_image_root;
+};
+
+struct processor_tree_record_t
+{
+	std::uintptr_t m_parent;
+	std::uintptr_t m_id;
+	std::uint16_t m_child_idx;
+	bool m_is_delay;
+	bool m_is_missing;
+	bool m_is_32_bit;
+	std::wstring m_name;
+	std::wstring m_path;
+};
+
+typedef void* processor_progress_param_t;
+typedef void(*processor_progress_fn_t)(processor_progress_param_t const param);
+
+struct processor_progress_t
+{
+	std::atomic<bool> m_canceled;
+	std::atomic<int> m_modules;
+	std::atomic<int> m_queued;
+	std::atomic<std::uint64_t> m_bytes_mapped;
+	processor_progress_fn_t m_fn;
+	processor_progress_param_t m_param;
+	bool m_want_tree_records;
+	std::mutex m_tree_records_mutex;
+	std::vector<processor_tree_record_t> m_tree_records;
+};
+
+
+class processor_job
+{
+public:
+	processor_job();
+	processor_job(processor_job const&) = delete;
+	processor_job(processor_job&&) noexcept = delete;
+	processor_job& operator=(processor_job const&) = delete;
+	processor_job& operator=(processor_job&&) noexcept = delete;
+	~processor_job();
+public:
+	void start(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, processor_progress_fn_t const fn, processor_progress_param_t const param);
+	void cancel();
+	void wait();
+	bool finish(main_type* const mo_out);
+	bool is_busy() const;
+	bool is_done() const;
+	bool is_incremental() const;
+	processor_progress_t const& get_progress() const;
+	void take_tree_records(std::vector<processor_tree_record_t>* const records_out);
+private:
+	void thread_func();
+private:
+	std::thread m_thread;
+	std::vector<std::wstring> m_file_paths;
+	processor_options_t m_options;
+	session_snapshot m_prev;
+	bool m_incremental;
+	processor_progress_t m_progress;
+	main_type m_mo;
+	bool m_processed;
+	std::atomic<bool> m_done;
+};
+
+
+bool process(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, main_type* const mo_out);
@@ -1,239 +1,572 @@
-#include "processor_impl.h"
-
-#include "file_info_getters.h"
-#include "import_export_matcher.h"
-#include "processor.h"
-#include "tree_algos.h"
-
-#include "../nogui/act_ctx.h"
-#include "../nogui/assert_my.h"
-#include "../nogui/cassert_my.h"
-#include "../nogui/dependency_locator.h"
-#include "../nogui/file_name_provider.h"
-#include "../nogui/memory_mapped_file.h"
-#include "../nogui/my_actctx.h"
-#include "../nogui/pe2.h"
-#include "../nogui/scope_exit.h"
-
-#include <algorithm>
-#include <cstdint>
-#include <iterator>
-
-
-static constexpr wchar_t const s_dummy_textw_r[] = L"";
-static constexpr wstring const s_dummy_textw_s = {s_dummy_textw_r, static_cast<int>(std::size(s_dummy_textw_r)) - 1};
-static constexpr wstring_handle const s_dummy_textw_h = {&s_dummy_textw_s};
-static constexpr char const s_dummy_texta_r[] = "";
-static constexpr string const s_dummy_texta_s = {s_dummy_texta_r, static_cast<int>(std::size(s_dummy_texta_r)) - 1};
-static constexpr string_handle const s_dummy_texta_h = {&s_dummy_texta_s};
-
-
-bool process_impl(std::vector<std::wstring> const& file_paths, main_type& mo)
-{
-	my_actctx::deactivate();
-	auto const activate_my_actctx = mk::make_scope_exit([](){ my_actctx::activate(); });
-	WARN_M_R(file_paths.size() < 0xFFFF, L"Too many files to process.", false);
-	file_info* const fi = mo.m_mm.m_alc.allocate_objects<file_info>(1);
-	init(fi);
-	mo.m_fi = fi;
-	std::uint16_t const n = static_cast<std::uint16_t>(file_paths.size());
-	file_info* const fis = mo.m_mm.m_alc.allocate_objects<file_info>(n);
-	init(fis, n);
-	string_handle* const dll_names = mo.m_mm.m_alc.allocate_objects<string_handle>(n);
-	std::fill(dll_names, dll_names + n, s_dummy_texta_h);
-	std::uint16_t* const import_counts = mo.m_mm.m_alc.allocate_objects<std::uint16_t>(n);
-	std::fill(import_counts, import_counts + n, std::uint16_t{0});
-	fi->m_fis = fis;
-	fi->m_file_path = s_dummy_textw_h;
-	fi->m_import_table.m_normal_dll_count = n;
-	fi->m_import_table.m_delay_dll_count = 0;
-	fi->m_import_table.m_dll_names = dll_names;
-	fi->m_import_table.m_import_counts = import_counts;
-	tmp_type to;
-	to.m_mo = &mo;
-	to.m_mm = &mo.m_mm;
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		file_info& sub_fi = fi->m_fis[i];
-		int const path_len = static_cast<int>(file_paths[i].size());
-		wchar_t const* const cstr = file_paths[i].c_str();
-		wstring_handle const normalized = file_name_provider::get_correct_file_name(cstr, path_len, to.m_mm->m_wstrs, to.m_mm->m_alc);
-		sub_fi.m_file_path = normalized;
-		dependency_locator& dl = to.m_dl;
-		dl.m_main_path = normalized;
-		assert(to.m_queue.empty());
-		to.m_queue.push_back(&sub_fi);
-		bool const step = step_1(to);
-		WARN_M_R(step, L"Failed to step_1.", false);
-	}
-	pair_all(*fi, to);
-	make_doubly_linked_list(*fi);
-	mo.m_modules_list = make_modules_list(to);
-	return true;
-}
-
-
-void make_doubly_linked_list(file_info& fi)
-{
-	static constexpr auto const make_list = [](file_info& fi, [[maybe_unused]] void* const data)
-	{
-		file_info* const orig = fi.m_orig_instance;
-		if(!orig)
-		{
-			return;
-		}
-		fi.m_next_instance = orig;
-		fi.m_prev_instance = orig->m_prev_instance ? orig->m_prev_instance : orig;
-		(orig->m_prev_instance ? orig->m_prev_instance : orig)->m_next_instance = &fi;
-		orig->m_prev_instance = &fi;
-	};
-	depth_first_visit(fi, make_list, nullptr);
-}
-
-modules_list_t make_modules_list(tmp_type const& to)
-{
-	static constexpr auto const make_non_found_modules = [](tmp_type const& to)
-	{
-		struct case_insensitive_file_info_file_name_hash_t
-		{
-			std::size_t operator()(file_info const* const& fi) const
-			{
-				assert(fi);
-				auto const& dll_name = get_dll_name_no_path(fi);
-				assert(dll_name);
-				auto const ret = string_handle_case_insensitive_hash{}(dll_name);
-				return ret;
-			}
-		};
-		struct case_insensitive_file_info_file_name_equals_t
-		{
-			bool operator()(file_info const* const& a, file_info const* const& b) const
-			{
-				assert(a);
-				assert(b);
-				auto const& dll_name_a = get_dll_name_no_path(a);
-				auto const& dll_name_b = get_dll_name_no_path(b);
-				assert(dll_name_a);
-				assert(dll_name_b);
-				auto const ret = string_handle_case_insensitive_equal{}(dll_name_a, dll_name_b);
-				return ret;
-			}
-		};
-		typedef std::unordered_set<file_info*, case_insensitive_file_info_file_name_hash_t, case_insensitive_file_info_file_name_equals_t> not_found_fis_t;
-
-		static constexpr auto const process_not_found_fi = [](file_info& fi, void* const data)
-		{
-			if(!fi.m_orig_instance && !fi.m_file_path)
-			{
-				assert(data);
-				auto& not_found_fis = *static_cast<not_found_fis_t*>(data);
-				not_found_fis.insert(&fi);
-			}
-		};
-
-		not_found_fis_t not_found_fis;
-		depth_first_visit(*to.m_mo->m_fi, process_not_found_fi, &not_found_fis);
-		return not_found_fis;
-	};
-
-	auto const not_found_fis = make_non_found_modules(to);
-	int const n1 = static_cast<int>(not_found_fis.size());
-	int const n2 = static_cast<int>(to.m_map.size());
-	assert(n1 <= 0xFFFF && n2 <= 0xFFFF && n1 + n2 <= 0xFFFF);
-	std::uint16_t const n = static_cast<std::uint16_t>(n1 + n2);
-	file_info** const modules_list = to.m_mm->m_alc.allocate_objects<file_info*>(n);
-	std::copy(not_found_fis.begin(), not_found_fis.end(), modules_list);
-	std::transform(to.m_map.begin(), to.m_map.end(), modules_list + n1, [](auto const& e){ return e->m_instance; });
-	std::sort(modules_list, modules_list + n, compare_fi_by_path_or_name);
-
-	modules_list_t ret;
-	ret.m_list = modules_list;
-	ret.m_count = n;
-	return ret;
-}
-
-
-bool step_1(tmp_type& to)
-{
-	while(!to.m_queue.empty())
-	{
-		file_info* const fi = to.m_queue.front();
-		assert(fi != nullptr);
-		to.m_queue.pop_front();
-		bool const step = step_2(*fi, to);
-		WARN_M_R(step, L"Failed to step_2.", false);
-	}
-	return true;
-}
-
-bool step_2(file_info& fi, tmp_type& to)
-{
-	fat_type tmp;
-	tmp.m_instance = &fi;
-	auto const it = to.m_map.find(&tmp);
-	if(it != to.m_map.end())
-	{
-		assert((*it)->m_instance);
-		file_info* const orig = (*it)->m_instance;
-		fi.m_orig_instance = orig;
-		fi.m_file_path = wstring_handle{};
-		return true;
-	}
-	std::uint16_t const* enpt;
-	std::uint16_t enpt_count;
-	pe_tables tables;
-	tables.m_tmp_alc = &to.m_tmp_alc;
-	tables.m_iti_out = &fi.m_import_table;
-	tables.m_eti_out = &fi.m_export_table;
-	tables.m_enpt_count_out = &enpt_count;
-	tables.m_enpt_out = &enpt;
-	{
-		memory_mapped_file const mmf = memory_mapped_file(fi.m_file_path.m_string->m_str);
-		WARN_M_R(mmf.begin() != nullptr, L"Failed to memory_mapped_file.", false);
-		bool const tables_processed = pe_process_all(mmf.begin(), mmf.size(), *to.m_mm, &tables);
-		WARN_M_R(tables_processed, L"Failed to pe_process_all.", false);
-	}
-	fi.m_is_32_bit = tables.m_is_32_bit;
-	fat_type* const fo = to.m_tmp_alc.allocate_objects<fat_type>(1);
-	fo->m_instance = &fi;
-	fo->m_enpt.m_table = enpt;
-	fo->m_enpt.m_count = enpt_count;
-	auto const itb = to.m_map.insert(fo);
-	assert(itb.second);
-	std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
-	file_info* const fis = to.m_mm->m_alc.allocate_objects<file_info>(n);
-	init(fis, n);
-	std::for_each(fis, fis + n, [&](file_info& sub_fi){ sub_fi.m_parent = &fi; });
-	fi.m_fis = fis;
-	dependency_locator& dl = to.m_dl;
-	actctx_state_t actctx_state;
-	bool const actctx_created = create_actctx(dl.m_main_path, fi.m_file_path, tables.m_manifest_id, &actctx_state);
-	WARN_M_R(actctx_created, L"Failed to create_actctx.", false);
-	auto const fn_destroy_actctx = mk::make_scope_exit([&](){ destroy_actctx(actctx_state); });
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		bool const step = step_3(fi, i, to);
-		WARN_M_R(step, L"Failed to step_3.", false);
-	}
-	return true;
-}
-
-bool step_3(file_info const& fi, std::uint16_t const i, tmp_type& to)
-{
-	file_info& sub_fi = fi.m_fis[i];
-	dependency_locator& dl = to.m_dl;
-	dl.m_dependency = &fi.m_import_table.m_dll_names[i];
-	bool const located = locate_dependency(dl);
-	if(located)
-	{
-		std::wstring const& result = dl.m_result;
-		wstring_handle const normalized = file_name_provider::get_correct_file_name(result.c_str(), static_cast<int>(result.size()), to.m_mm->m_wstrs, to.m_mm->m_alc);
-		sub_fi.m_file_path = normalized;
-		to.m_queue.push_back(&sub_fi);
-		return true;
-	}
-	else
-	{
-		return true;
-	}
-}
+#include "processor_impl.h"
+
+#include "compactor.h"
+#include "file_info_getters.h"
+#include "forwarder_resolver.h"
+#include "import_export_matcher.h"
+#include "import_index.h"
+#include "module_graph.h"
+#include "processor.h"
+#include "tree_algos.h"
+
+#include "../nogui/act_ctx.h"
+#include "../nogui/array_bool.h"
+#include "../nogui/assert_my.h"
+#include "../nogui/cassert_my.h"
+#include "../nogui/dependency_locator.h"
+#include "../nogui/directory_index.h"
+#include "../nogui/file_fingerprint.h"
+#include "../nogui/file_name_provider.h"
+#include "../nogui/memory_mapped_file.h"
+#include "../nogui/offline_image.h"
+#include "../nogui/parallel_for.h"
+#include "../nogui/pe2.h"
+#include "../nogui/scope_exit.h"
+#include "../nogui/search_plan.h"
+#include "../nogui/sxs_manifest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+
+
+static constexpr wchar_t const s_dummy_textw_r[] = L"";
+static constexpr wstring const s_dummy_textw_s = {s_dummy_textw_r, static_cast<int>(std::size(s_dummy_textw_r)) - 1};
+static constexpr wstring_handle const s_dummy_textw_h = {&s_dummy_textw_s};
+static constexpr char const s_dummy_texta_r[] = "";
+static constexpr string const s_dummy_texta_s = {s_dummy_texta_r, static_cast<int>(std::size(s_dummy_texta_r)) - 1};
+static constexpr string_handle const s_dummy_texta_h = {&s_dummy_texta_s};
+
+
+static file_info const* find_prev_module(main_type const& prev, file_info const& fi, module_fingerprint* const fingerprint_in_out);
+
+
+bool process_impl(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, processor_progress_t* const progress, main_type& mo)
+{
+	WARN_M_R(file_paths.size() < 0xFFFF, L"Too many files to process.", false);
+	file_info* const fi = mo.m_mm.m_alc.allocate_objects<file_info>(1);
+	init(fi);
+	mo.m_fi = fi;
+	std::uint16_t const n = static_cast<std::uint16_t>(file_paths.size());
+	file_info* const fis = mo.m_mm.m_alc.allocate_objects<file_info>(n);
+	init(fis, n);
+	string_handle* const dll_names = mo.m_mm.m_alc.allocate_objects<string_handle>(n);
+	std::fill(dll_names, dll_names + n, s_dummy_texta_h);
+	std::uint16_t* const import_counts = mo.m_mm.m_alc.allocate_objects<std::uint16_t>(n);
+	std::fill(import_counts, import_counts + n, std::uint16_t{0});
+	fi->m_fis = fis;
+	fi->m_file_path = s_dummy_textw_h;
+	fi->m_import_table.m_normal_dll_count = n;
+	fi->m_import_table.m_delay_dll_count = 0;
+	fi->m_import_table.m_dll_names = dll_names;
+	fi->m_import_table.m_import_counts = import_counts;
+	directory_index::begin_session();
+	std::vector<memory_manager> worker_mms(parallel_for_worker_count());
+	std::vector<module_fingerprint> fingerprints;
+	{
+		tmp_type to;
+		to.m_mo = &mo;
+		to.m_prev = prev && prev->m_fi ? prev : nullptr;
+		to.m_progress = progress;
+		to.m_depth = options.m_depth;
+		to.m_mm = &mo.m_mm;
+		for(std::wstring const& expanded : options.m_expanded)
+		{
+			to.m_expanded.insert(to.m_mm->m_wstrs.add_string(expanded.c_str(), static_cast<int>(expanded.size()), to.m_mm->m_alc));
+		}
+		if(!options.m_image_root.empty())
+		{
+			offline_image* const image = offline_images::get(options.m_image_root);
+			WARN_M_R(image, L"Failed to load offline image.", false);
+			make_offline_search_plan(*image, &to.m_plan);
+		}
+		else
+		{
+			bool const plan_made = make_native_search_plan(&to.m_plan);
+			WARN_M_R(plan_made, L"Failed to make_native_search_plan.", false);
+			if(!options.m_winsxs.empty())
+			{
+				bool const catalog_inited = to.m_sxs_catalog.init(options.m_winsxs);
+				WARN_M_R(catalog_inited, L"Failed to init sxs_catalog.", false);
+				search_plan_use_sxs_catalog(&to.m_plan, &to.m_sxs_catalog);
+			}
+		}
+		to.m_workers.resize(worker_mms.size());
+		for(int i = 0; i != static_cast<int>(worker_mms.size()); ++i)
+		{
+			to.m_workers[i].m_mm = &worker_mms[i];
+			to.m_workers[i].m_cache = &to.m_cache;
+			to.m_workers[i].m_dl.m_plan = &to.m_plan;
+			to.m_workers[i].m_external_manifests = &to.m_external_manifests;
+		}
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			file_info& sub_fi = fi->m_fis[i];
+			int const path_len = static_cast<int>(file_paths[i].size());
+			wchar_t const* const cstr = file_paths[i].c_str();
+			wstring_handle const normalized = file_name_provider::get_correct_file_name(cstr, path_len, to.m_mm->m_wstrs, to.m_mm->m_alc);
+			sub_fi.m_file_path = normalized;
+			to.m_queue.push_back(queued_type{&sub_fi, normalized});
+			if(to.m_plan.m_sxs_catalog)
+			{
+				std::wstring const manifest_path = std::wstring{cbegin(normalized), cend(normalized)}.append(L".manifest");
+				sxs_manifest manifest;
+				bool manifest_found;
+				bool const manifest_read = sxs_read_manifest_file(manifest_path.c_str(), &manifest_found, &manifest);
+				WARN_M(manifest_read, L"Failed to sxs_read_manifest_file.");
+				if(manifest_read && manifest_found)
+				{
+					to.m_external_manifests.emplace(normalized, std::move(manifest));
+				}
+			}
+		}
+		bool const step = step_1(to);
+		if(!step && progress && progress->m_canceled.load())
+		{
+			return false;
+		}
+		WARN_M_R(step, L"Failed to step_1.", false);
+		make_tree_order(*fi, mo.m_mm.m_alc, &mo.m_tree_order);
+		pair_all(mo.m_tree_order, to);
+		make_doubly_linked_list(mo.m_tree_order);
+		mo.m_modules_list = make_modules_list(to);
+		resolve_forwarders(mo.m_modules_list, to);
+		mo.m_stats.m_dependency_cache_hits = to.m_cache.get_hits();
+		mo.m_stats.m_dependency_cache_misses = to.m_cache.get_misses();
+		fingerprints.resize(mo.m_modules_list.m_count);
+		std::transform(mo.m_modules_list.m_list, mo.m_modules_list.m_list + mo.m_modules_list.m_count, fingerprints.begin(), [&](file_info* const& module)
+		{
+			if(!module->m_file_path)
+			{
+				return module_fingerprint{};
+			}
+			fat_type tmp;
+			tmp.m_instance = module;
+			auto const it = to.m_map.find(&tmp);
+			assert(it != to.m_map.end());
+			return (*it)->m_fingerprint;
+		});
+	}
+	compact(mo);
+	make_module_graph(mo.m_modules_list, mo.m_mm.m_alc, &mo.m_graph);
+	make_import_index(mo.m_modules_list, mo.m_graph, mo.m_mm.m_alc, &mo.m_importers);
+	mo.m_fingerprints = mo.m_mm.m_alc.allocate_objects<module_fingerprint>(mo.m_modules_list.m_count);
+	std::copy(fingerprints.begin(), fingerprints.end(), mo.m_fingerprints);
+	return true;
+}
+
+
+void make_doubly_linked_list(tree_order const& order)
+{
+	for(std::uint32_t i = 0; i != order.m_count; ++i)
+	{
+		file_info& fi = *order.m_list[i];
+		file_info* const orig = fi.m_orig_instance;
+		if(!orig)
+		{
+			continue;
+		}
+		fi.m_next_instance = orig;
+		fi.m_prev_instance = orig->m_prev_instance ? orig->m_prev_instance : orig;
+		(orig->m_prev_instance ? orig->m_prev_instance : orig)->m_next_instance = &fi;
+		orig->m_prev_instance = &fi;
+	}
+}
+
+modules_list_t make_modules_list(tmp_type const& to)
+{
+	static constexpr auto const make_non_found_modules = [](tmp_type const& to)
+	{
+		struct case_insensitive_file_info_file_name_hash_t
+		{
+			std::size_t operator()(file_info const* const& fi) const
+			{
+				assert(fi);
+				auto const& dll_name = get_dll_name_no_path(fi);
+				assert(dll_name);
+				auto const ret = string_handle_case_insensitive_hash{}(dll_name);
+				return ret;
+			}
+		};
+		struct case_insensitive_file_info_file_name_equals_t
+		{
+			bool operator()(file_info const* const& a, file_info const* const& b) const
+			{
+				assert(a);
+				assert(b);
+				auto const& dll_name_a = get_dll_name_no_path(a);
+				auto const& dll_name_b = get_dll_name_no_path(b);
+				assert(dll_name_a);
+				assert(dll_name_b);
+				auto const ret = string_handle_case_insensitive_equal{}(dll_name_a, dll_name_b);
+				return ret;
+			}
+		};
+		typedef std::unordered_set<file_info*, case_insensitive_file_info_file_name_hash_t, case_insensitive_file_info_file_name_equals_t> not_found_fis_t;
+
+		not_found_fis_t not_found_fis;
+		tree_order const& order = to.m_mo->m_tree_order;
+		for(std::uint32_t i = 0; i != order.m_count; ++i)
+		{
+			file_info& fi = *order.m_list[i];
+			if(!fi.m_orig_instance && !fi.m_file_path)
+			{
+				not_found_fis.insert(&fi);
+			}
+		}
+		return not_found_fis;
+	};
+
+	auto const not_found_fis = make_non_found_modules(to);
+	int const n1 = static_cast<int>(not_found_fis.size());
+	int const n2 = static_cast<int>(to.m_map.size());
+	assert(n1 <= 0xFFFF && n2 <= 0xFFFF && n1 + n2 <= 0xFFFF);
+	std::uint16_t const n = static_cast<std::uint16_t>(n1 + n2);
+	file_info** const modules_list = to.m_mm->m_alc.allocate_objects<file_info*>(n);
+	std::copy(not_found_fis.begin(), not_found_fis.end(), modules_list);
+	std::transform(to.m_map.begin(), to.m_map.end(), modules_list + n1, [](auto const& e){ return e->m_instance; });
+	std::sort(modules_list, modules_list + n, compare_fi_by_path_or_name);
+
+	modules_list_t ret;
+	ret.m_list = modules_list;
+	ret.m_count = n;
+	return ret;
+}
+
+
+bool step_1(tmp_type& to)
+{
+	static constexpr auto const dedup = [](queued_type const& queued, tmp_type& to)
+	{
+		file_info& fi = *queued.m_fi;
+		fat_type tmp;
+		tmp.m_instance = &fi;
+		auto const it = to.m_map.find(&tmp);
+		if(it != to.m_map.end())
+		{
+			assert((*it)->m_instance);
+			file_info* const orig = (*it)->m_instance;
+			fi.m_orig_instance = orig;
+			fi.m_file_path = wstring_handle{};
+			return;
+		}
+		fat_type* const fo = to.m_tmp_alc.allocate_objects<fat_type>(1);
+		fo->m_instance = &fi;
+		fo->m_main_path = queued.m_main_path;
+		fo->m_enpt.m_table = nullptr;
+		fo->m_enpt.m_count = 0;
+		fo->m_prev = nullptr;
+		fo->m_fingerprint = module_fingerprint{};
+		auto const itb = to.m_map.insert(fo);
+		assert(itb.second);
+		to.m_level.push_back(fo);
+	};
+	static constexpr auto const fingerprint_fn = [](int const idx, [[maybe_unused]] int const worker_idx, parallel_for_param_t const param)
+	{
+		assert(param);
+		tmp_type& to = *static_cast<tmp_type*>(param);
+		fat_type& fo = *to.m_level[idx];
+		if(fo.m_instance->m_is_deferred)
+		{
+			return;
+		}
+		get_file_fingerprint(fo.m_instance->m_file_path.m_string->m_str, &fo.m_fingerprint.m_file);
+		fo.m_prev = to.m_prev ? find_prev_module(*to.m_prev, *fo.m_instance, &fo.m_fingerprint) : nullptr;
+	};
+	static constexpr auto const parallel_fn = [](int const idx, int const worker_idx, parallel_for_param_t const param)
+	{
+		assert(param);
+		tmp_type& to = *static_cast<tmp_type*>(param);
+		fat_type& fo = *to.m_level[idx];
+		if(fo.m_instance->m_is_deferred)
+		{
+			return;
+		}
+		if(fo.m_prev)
+		{
+			bool const step = step_2_reuse(fo, to.m_workers[worker_idx]);
+			if(!step)
+			{
+				to.m_failed = true;
+			}
+			return;
+		}
+		memory_mapped_file const mmf = to.m_prefetcher.get(idx);
+		if(to.m_progress)
+		{
+			to.m_progress->m_bytes_mapped.fetch_add(static_cast<std::uint64_t>(mmf.size()), std::memory_order_relaxed);
+		}
+		bool const step = step_2(fo, mmf, to.m_workers[worker_idx]);
+		if(!step)
+		{
+			to.m_failed = true;
+		}
+	};
+	static constexpr auto const enqueue = [](fat_type const& fo, tmp_type& to)
+	{
+		file_info& fi = *fo.m_instance;
+		std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			file_info& sub_fi = fi.m_fis[i];
+			if(!sub_fi.m_file_path.m_string)
+			{
+				continue;
+			}
+			to.m_queue.push_back(queued_type{&sub_fi, fo.m_main_path});
+		}
+	};
+	static constexpr auto const add_tree_records = [](file_info const& fi, bool const is_root, std::vector<processor_tree_record_t>& records)
+	{
+		std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+		for(std::uint16_t i = 0; i != n; ++i)
+		{
+			file_info const& sub_fi = fi.m_fis[i];
+			file_info const& real_fi = sub_fi.m_orig_instance ? *sub_fi.m_orig_instance : sub_fi;
+			string_handle const& dll_name = fi.m_import_table.m_dll_names[i];
+			processor_tree_record_t& record = records.emplace_back();
+			record.m_parent = is_root ? 0 : reinterpret_cast<std::uintptr_t>(&fi);
+			record.m_id = reinterpret_cast<std::uintptr_t>(&sub_fi);
+			record.m_child_idx = i;
+			record.m_is_delay = i >= fi.m_import_table.m_normal_dll_count;
+			record.m_is_missing = real_fi.m_file_path.m_string == nullptr;
+			record.m_is_32_bit = is_root ? real_fi.m_is_32_bit : fi.m_is_32_bit;
+			record.m_name.assign(cbegin(dll_name), cend(dll_name));
+			if(!record.m_is_missing)
+			{
+				record.m_path.assign(cbegin(real_fi.m_file_path), cend(real_fi.m_file_path));
+			}
+		}
+	};
+	for(std::uint16_t depth = 0; !to.m_queue.empty(); ++depth)
+	{
+		if(to.m_progress && to.m_progress->m_canceled.load())
+		{
+			return false;
+		}
+		assert(to.m_level.empty());
+		for(queued_type const& queued : to.m_queue)
+		{
+			assert(queued.m_fi != nullptr);
+			dedup(queued, to);
+		}
+		to.m_queue.clear();
+		if(to.m_depth != 0 && depth >= to.m_depth)
+		{
+			for(fat_type* const fo : to.m_level)
+			{
+				fo->m_instance->m_is_deferred = !to.m_expanded.contains(fo->m_instance->m_file_path);
+			}
+		}
+		parallel_for(static_cast<int>(to.m_level.size()), fingerprint_fn, &to);
+		std::vector<wchar_t const*> file_names(to.m_level.size());
+		std::transform(to.m_level.begin(), to.m_level.end(), file_names.begin(), [](fat_type const* const& fo){ return fo->m_prev || fo->m_instance->m_is_deferred ? nullptr : fo->m_instance->m_file_path.m_string->m_str; });
+		to.m_prefetcher.start(file_names);
+		to.m_failed = false;
+		parallel_for(static_cast<int>(to.m_level.size()), parallel_fn, &to);
+		WARN_M_R(!to.m_failed, L"Failed to step_2.", false);
+		for(fat_type* const fo : to.m_level)
+		{
+			enqueue(*fo, to);
+		}
+		if(to.m_progress && to.m_progress->m_want_tree_records)
+		{
+			std::vector<processor_tree_record_t> records;
+			if(depth == 0)
+			{
+				add_tree_records(*to.m_mo->m_fi, true, records);
+			}
+			for(fat_type const* const fo : to.m_level)
+			{
+				add_tree_records(*fo->m_instance, false, records);
+			}
+			std::lock_guard<std::mutex> const lck(to.m_progress->m_tree_records_mutex);
+			std::move(records.begin(), records.end(), std::back_inserter(to.m_progress->m_tree_records));
+		}
+		if(to.m_progress)
+		{
+			to.m_progress->m_modules.fetch_add(static_cast<int>(to.m_level.size()));
+			to.m_progress->m_queued.store(static_cast<int>(to.m_queue.size()));
+			to.m_progress->m_fn(to.m_progress->m_param);
+		}
+		to.m_level.clear();
+	}
+	return true;
+}
+
+bool step_2(fat_type& fo, memory_mapped_file const& mmf, worker_type& wt)
+{
+	file_info& fi = *fo.m_instance;
+	std::uint16_t const* enpt;
+	std::uint16_t enpt_count;
+	pe_tables tables;
+	tables.m_tmp_alc = &wt.m_tmp_alc;
+	tables.m_iti_out = &fi.m_import_table;
+	tables.m_eti_out = &fi.m_export_table;
+	tables.m_enpt_count_out = &enpt_count;
+	tables.m_enpt_out = &enpt;
+	WARN_M_R(mmf.begin() != nullptr, L"Failed to memory_mapped_file.", false);
+	bool const tables_processed = pe_process_all(mmf.begin(), mmf.size(), *wt.m_mm, &tables);
+	WARN_M_R(tables_processed, L"Failed to pe_process_all.", false);
+	fi.m_time_date_stamp = tables.m_time_date_stamp;
+	fi.m_image_size = tables.m_image_size;
+	std::copy(std::cbegin(tables.m_pdb_guid), std::cend(tables.m_pdb_guid), fi.m_pdb_guid);
+	fi.m_pdb_age = tables.m_pdb_age;
+	fi.m_is_32_bit = tables.m_is_32_bit;
+	fo.m_enpt.m_table = enpt;
+	fo.m_enpt.m_count = enpt_count;
+	fo.m_fingerprint.m_manifest_id = tables.m_manifest_id;
+	return step_2_locate(fi, fo.m_main_path, mmf.begin(), tables.m_manifest_id, wt);
+}
+
+bool step_2_reuse(fat_type& fo, worker_type& wt)
+{
+	assert(fo.m_prev);
+	file_info& fi = *fo.m_instance;
+	file_info const& prev_fi = *fo.m_prev;
+	compactor_copy_import_table(prev_fi.m_import_table, &fi.m_import_table, *wt.m_mm);
+	compactor_copy_export_table(prev_fi.m_export_table, &fi.m_export_table, *wt.m_mm);
+	fi.m_time_date_stamp = prev_fi.m_time_date_stamp;
+	fi.m_image_size = prev_fi.m_image_size;
+	std::copy(std::cbegin(prev_fi.m_pdb_guid), std::cend(prev_fi.m_pdb_guid), fi.m_pdb_guid);
+	fi.m_pdb_age = prev_fi.m_pdb_age;
+	fi.m_is_32_bit = prev_fi.m_is_32_bit;
+	pe_import_table_info& iti = fi.m_import_table;
+	std::uint16_t const n = iti.m_normal_dll_count + iti.m_delay_dll_count;
+	for(std::uint16_t i = 0; i != n && iti.m_matched_exports; ++i)
+	{
+		std::fill(iti.m_matched_exports[i], iti.m_matched_exports[i] + iti.m_import_counts[i], static_cast<std::uint16_t>(0xFFFE));
+	}
+	pe_export_table_info& eti = fi.m_export_table;
+	if(eti.m_count != 0)
+	{
+		std::fill(eti.m_are_used.m_data, eti.m_are_used.m_data + array_bool_space_needed(eti.m_count), 0u);
+	}
+	std::uint16_t const enpt_count = static_cast<std::uint16_t>(std::count_if(eti.m_hints, eti.m_hints + eti.m_count, [](std::uint16_t const& hint){ return hint != 0xFFFF; }));
+	std::uint16_t* const enpt = wt.m_tmp_alc.allocate_objects<std::uint16_t>(enpt_count);
+	for(std::uint16_t i = 0; i != eti.m_count; ++i)
+	{
+		if(eti.m_hints[i] != 0xFFFF)
+		{
+			assert(eti.m_hints[i] < enpt_count);
+			enpt[eti.m_hints[i]] = i;
+		}
+	}
+	fo.m_enpt.m_table = enpt;
+	fo.m_enpt.m_count = enpt_count;
+	return step_2_locate(fi, fo.m_main_path, nullptr, fo.m_fingerprint.m_manifest_id, wt);
+}
+
+bool step_2_locate(file_info& fi, wstring_handle const& main_path, std::byte const* const file_data, std::uint32_t const manifest_id, worker_type& wt)
+{
+	std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
+	file_info* const fis = wt.m_mm->m_alc.allocate_objects<file_info>(n);
+	init(fis, n);
+	std::for_each(fis, fis + n, [&](file_info& sub_fi){ sub_fi.m_parent = &fi; });
+	fi.m_fis = fis;
+	dependency_locator& dl = wt.m_dl;
+	dl.m_main_path = main_path;
+	actctx_state_t actctx_state{};
+	bool external_manifest = false;
+	if(dl.m_plan->m_sxs_catalog)
+	{
+		bool const manifest_processed = step_2_manifest(fi, file_data, manifest_id, &external_manifest, wt);
+		WARN_M_R(manifest_processed, L"Failed to step_2_manifest.", false);
+	}
+	else
+	{
+		bool const actctx_created = create_actctx(dl.m_main_path, fi.m_file_path, manifest_id, &actctx_state);
+		WARN_M_R(actctx_created, L"Failed to create_actctx.", false);
+	}
+	auto const fn_destroy_actctx = mk::make_scope_exit([&](){ destroy_actctx(actctx_state); });
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		bool const step = step_3(fi, manifest_id, external_manifest, i, wt);
+		WARN_M_R(step, L"Failed to step_3.", false);
+	}
+	return true;
+}
+
+bool step_2_manifest(file_info const& fi, std::byte const* const file_data, std::uint32_t const manifest_id, bool* const external_manifest_out, worker_type& wt)
+{
+	assert(external_manifest_out);
+	dependency_locator& dl = wt.m_dl;
+	if(manifest_id == 0)
+	{
+		auto const it = wt.m_external_manifests->find(dl.m_main_path);
+		*external_manifest_out = it != wt.m_external_manifests->end();
+		locate_dependency_sxs_prepare(dl, it != wt.m_external_manifests->end() ? &it->second : nullptr, fi.m_is_32_bit);
+		return true;
+	}
+	memory_mapped_file mmf;
+	std::byte const* data = file_data;
+	if(!data)
+	{
+		memory_mapped_file tmp{fi.m_file_path.m_string->m_str};
+		mmf.swap(tmp);
+		data = mmf.begin();
+		WARN_M_R(data, L"Failed to memory_mapped_file.", false);
+	}
+	char const* manifest_data;
+	int manifest_size;
+	bool const manifest_found = pe_process_resource_manifest_data(data, manifest_id, &manifest_data, &manifest_size);
+	WARN_M_R(manifest_found, L"Failed to pe_process_resource_manifest_data.", false);
+	bool const manifest_parsed = manifest_data && sxs_parse_manifest(manifest_data, manifest_size, &wt.m_manifest);
+	locate_dependency_sxs_prepare(dl, manifest_parsed ? &wt.m_manifest : nullptr, fi.m_is_32_bit);
+	return true;
+}
+
+bool step_3(file_info const& fi, std::uint32_t const manifest_id, bool const external_manifest, std::uint16_t const i, worker_type& wt)
+{
+	file_info& sub_fi = fi.m_fis[i];
+	dependency_locator& dl = wt.m_dl;
+	dl.m_dependency = &fi.m_import_table.m_dll_names[i];
+	dependency_cache_key const key = make_dependency_cache_key(*dl.m_dependency, dl.m_main_path, fi.m_file_path, manifest_id, external_manifest);
+	dependency_cache_value cached;
+	bool const found = wt.m_cache->find(key, &cached);
+	if(!found)
+	{
+		bool const located = locate_dependency(dl);
+		bool const normalized = located && file_name_provider::get_correct_file_name(dl.m_result.c_str(), static_cast<int>(dl.m_result.size()), &wt.m_file_path);
+		cached = wt.m_cache->insert(key, normalized, wt.m_file_path.c_str(), normalized ? static_cast<int>(wt.m_file_path.size()) : 0);
+	}
+	if(cached.m_located)
+	{
+		sub_fi.m_file_path = wt.m_mm->m_wstrs.add_string(cbegin(cached.m_result), size(cached.m_result), wt.m_mm->m_alc);
+		return true;
+	}
+	else
+	{
+		return true;
+	}
+}
+
+
+file_info const* find_prev_module(main_type const& prev, file_info const& fi, module_fingerprint* const fingerprint_in_out)
+{
+	assert(fingerprint_in_out);
+	modules_list_t const& modules_list = prev.m_modules_list;
+	file_info** const list_end = modules_list.m_list + modules_list.m_count;
+	auto const it = std::lower_bound(modules_list.m_list, list_end, fi.m_file_path, [](file_info const* const& e, wstring_handle const& v)
+	{
+		return !e->m_file_path || wstring_handle_case_insensitive_less{}(e->m_file_path, v);
+	});
+	if(it == list_end || !(*it)->m_file_path || wstring_handle_case_insensitive_less{}(fi.m_file_path, (*it)->m_file_path))
+	{
+		return nullptr;
+	}
+	if((*it)->m_is_deferred)
+	{
+		return nullptr;
+	}
+	module_fingerprint const& prev_fingerprint = prev.m_fingerprints[it - modules_list.m_list];
+	if(!file_fingerprint_equal(fingerprint_in_out->m_file, prev_fingerprint.m_file))
+	{
+		return nullptr;
+	}
+	fingerprint_in_out->m_manifest_id = prev_fingerprint.m_manifest_id;
+	return *it;
+}
@@ -1,64 +1,107 @@
-#pragma once
-
-
-#include "processor.h"
-
-#include "../nogui/allocator.h"
-#include "../nogui/dependency_locator.h"
-#include "../nogui/memory_manager.h"
-#include "../nogui/my_string_handle.h"
-
-#include <cstdint>
-#include <deque>
-#include <string>
-#include <unordered_map>
-#include <vector>
-
-
-struct enptr_type
-{
-	std::uint16_t const* m_table;
-	std::uint16_t m_count;
-};
-
-struct fat_type
-{
-	file_info* m_instance;
-	enptr_type m_enpt;
-};
-
-struct fat_type_hash
-{
-	std::size_t operator()(fat_type const* const& obj) const
-	{
-		return std::hash<wstring_handle>{}(obj->m_instance->m_file_path);
-	}
-};
-
-struct fat_type_eq
-{
-	bool operator()(fat_type const* const& a, fat_type const* const& b) const
-	{
-		return a->m_instance->m_file_path == b->m_instance->m_file_path;
-	}
-};
-
-struct tmp_type
-{
-	main_type* m_mo;
-	memory_manager* m_mm;
-	allocator m_tmp_alc;
-	std::deque<file_info*> m_queue;
-	std::unordered_set<fat_type*, fat_type_hash, fat_type_eq> m_map;
-	dependency_locator m_dl;
-};
-
-
-bool process_impl(std::vector<std::wstring> const& file_paths, main_type& mo);
-
-void make_doubly_linked_list(file_info& fi);
-modules_list_t make_modules_list(tmp_type const& to);
-
-bool step_1(tmp_type& to);
-bool step_2(file_info& fi, tmp_type& to);
-bool step_3(file_info const& fi, std::uint16_t const i, tmp_type& to);
+#pragma once
+
+
+#include "processor.h"
+
+#include "../nogui/allocator.h"
+#include "../nogui/dependency_cache.h"
+#include "../nogui/dependency_locator.h"
+#include "../nogui/file_prefetcher.h"
+#include "../nogui/memory_manager.h"
+#include "../nogui/memory_mapped_file.h"
+#include "../nogui/my_string_handle.h"
+#include "../nogui/search_plan.h"
+#include "../nogui/sxs_catalog.h"
+#include "../nogui/sxs_manifest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+struct enptr_type
+{
+	std::uint16_t const* m_table;
+	std::uint16_t m_count;
+};
+
+struct queued_type
+{
+	file_info* m_fi;
+	wstring_handle m_main_path;
+};
+
+struct fat_type
+{
+	file_info* m_instance;
+	wstring_handle m_main_path;
+	enptr_type m_enpt;
+	file_info const* m_prev;
+	module_fingerprint m_fingerprint;
+};
+
+struct fat_type_hash
+{
+	std::size_t operator()(fat_type const* const& obj) const
+	{
+		return std::hash<wstring_handle>{}(obj->m_instance->m_file_path);
+	}
+};
+
+struct fat_type_eq
+{
+	bool operator()(fat_type const* const& a, fat_type const* const& b) const
+	{
+		return a->m_instance->m_file_path == b->m_instance->m_file_path;
+	}
+};
+
+struct worker_type
+{
+	memory_manager* m_mm;
+	allocator m_tmp_alc;
+	dependency_locator m_dl;
+	dependency_cache* m_cache;
+	std::wstring m_file_path;
+	sxs_manifest m_manifest;
+	std::unordered_map<wstring_handle, sxs_manifest> const* m_external_manifests;
+};
+
+struct tmp_type
+{
+	main_type* m_mo;
+	main_type const* m_prev;
+	processor_progress_t* m_progress;
+	std::uint16_t m_depth;
+	std::unordered_set<wstring_handle> m_expanded;
+	memory_manager* m_mm;
+	allocator m_tmp_alc;
+	std::vector<queued_type> m_queue;
+	std::vector<fat_type*> m_level;
+	std::unordered_set<fat_type*, fat_type_hash, fat_type_eq> m_map;
+	search_plan m_plan;
+	sxs_catalog m_sxs_catalog;
+	std::unordered_map<wstring_handle, sxs_manifest> m_external_manifests;
+	std::vector<worker_type> m_workers;
+	dependency_cache m_cache;
+	file_prefetcher m_prefetcher;
+	std::atomic<bool> m_failed;
+	std::vector<std::uint16_t> m_unmatched;
+};
+
+
+bool process_impl(std::vector<std::wstring> const& file_paths, processor_options_t const& options, main_type const* const prev, processor_progress_t* const progress, main_type& mo);
+
+void make_doubly_linked_list(tree_order const& order);
+modules_list_t make_modules_list(tmp_type const& to);
+
+bool step_1(tmp_type& to);
+bool step_2(fat_type& fo, memory_mapped_file const& mmf, worker_type& wt);
+bool step_2_reuse(fat_type& fo, worker_type& wt);
+bool step_2_locate(file_info& fi, wstring_handle const& main_path, std::byte const* const file_data, std::uint32_t const manifest_id, worker_type& wt);
+bool step_2_manifest(file_info const& fi, std::byte const* const file_data, std::uint32_t const manifest_id, bool* const external_manifest_out, worker_type& wt);
+bool step_3(file_info const& fi, std::uint32_t const manifest_id, bool const external_manifest, std::uint16_t const i, worker_type& wt);
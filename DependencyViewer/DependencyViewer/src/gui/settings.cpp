@@ -1 +1 @@
-#include "settings.h"
+#include "settings.h"
@@ -1,13 +1,14 @@
-#pragma once
-
-
-#include <cstdint>
-
-
-struct settings
-{
-	bool m_full_paths;
-	bool m_undecorate;
-	std::uint8_t m_import_sort;
-	std::uint8_t m_export_sort;
-};
+#pragma once
+
+
+#include <cstdint>
+
+
+struct settings
+{
+	bool m_full_paths;
+	bool m_undecorate;
+	bool m_watch;
+	std::uint8_t m_import_sort;
+	std::uint8_t m_export_sort;
+};
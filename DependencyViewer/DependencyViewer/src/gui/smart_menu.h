@@ -1,12 +1,12 @@
-#pragma once
-
-
-#include <memory>
-
-
-struct smart_menu_deleter
-{
-	void operator()(void* const ptr) const;
-};
-
-typedef std::unique_ptr<void, smart_menu_deleter> smart_menu;
+#pragma once
+
+
+#include <memory>
+
+
+struct smart_menu_deleter
+{
+	void operator()(void* const ptr) const;
+};
+
+typedef std::unique_ptr<void, smart_menu_deleter> smart_menu;
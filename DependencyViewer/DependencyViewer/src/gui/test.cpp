@@ -1,96 +1,223 @@
-#include "test.h"
-
-#include "../nogui/cassert_my.h"
-#include "../nogui/memory_manager.h"
-#include "../nogui/memory_mapped_file.h"
-#include "../nogui/pe.h"
-#include "../nogui/pe2.h"
-#include "../nogui/scope_exit.h"
-#include "../nogui/smart_handle.h"
-
-#include <cwchar>
-#include <filesystem>
-#include <iterator>
-#include <memory>
-
-#include "../nogui/my_windows.h"
-
-#include <shellapi.h>
-
-
-#define s_very_big_int (2'147'483'647)
-
-
-void test()
-{
-	wchar_t const* const cmd_line = GetCommandLineW();
-	int argc;
-	wchar_t** const argv = CommandLineToArgvW(cmd_line, &argc);
-	auto const fn_free_argv = mk::make_scope_exit([&](){ [[maybe_unused]] HLOCAL const freed = LocalFree(argv); assert(freed == nullptr); });
-	if(argc != 3)
-	{
-		return;
-	}
-	if(std::wcsncmp(argv[1], s_cmd_arg_test, std::size(s_cmd_arg_test) - 1) != 0)
-	{
-		return;
-	}
-	std::filesystem::recursive_directory_iterator dir_it(argv[2], std::filesystem::directory_options::skip_permission_denied);
-	for(auto const& e : dir_it)
-	{
-		auto const& p = e.path();
-		if(std::filesystem::is_directory(p))
-		{
-			continue;
-		}
-		memory_mapped_file const mmf(p.c_str());
-		if(mmf.begin() == nullptr)
-		{
-			continue;
-		}
-		if(mmf.size() < 2)
-		{
-			continue;
-		}
-		if(reinterpret_cast<char const*>(mmf.begin())[0] != 'M')
-		{
-			continue;
-		}
-		if(reinterpret_cast<char const*>(mmf.begin())[1] != 'Z')
-		{
-			continue;
-		}
-		if(mmf.size() < 128)
-		{
-			continue;
-		}
-		std::uint16_t const& new_header_offset = *reinterpret_cast<std::uint16_t const*>(mmf.begin() + 60);
-		if(mmf.size() < new_header_offset + 4)
-		{
-			continue;
-		}
-		std::uint32_t const& new_header_header = *reinterpret_cast<std::uint32_t const*>(mmf.begin() + new_header_offset);
-		if(new_header_header != 0x00004550)
-		{
-			continue;
-		}
-		memory_manager mm;
-		std::uint16_t enpt_count;
-		std::uint16_t const* enpt;
-		allocator enpt_alloc;
-		pe_import_table_info iti;
-		pe_export_table_info eti;
-		pe_tables tables;
-		tables.m_tmp_alc = &enpt_alloc;
-		tables.m_iti_out = &iti;
-		tables.m_eti_out = &eti;
-		tables.m_enpt_count_out = &enpt_count;
-		tables.m_enpt_out = &enpt;
-		bool const tables_processed = pe_process_all(mmf.begin(), mmf.size(), mm, &tables);
-		if(!tables_processed)
-		{
-			OutputDebugStringW(p.c_str());
-			OutputDebugStringW(L"\n");
-		}
-	}
-}
+#include "test.h"
+
+#include "../nogui/array_bool.h"
+#include "../nogui/cassert_my.h"
+#include "../nogui/dbghelp.h"
+#include "../nogui/dependency_locator.h"
+#include "../nogui/memory_file_system.h"
+#include "../nogui/memory_manager.h"
+#include "../nogui/memory_mapped_file.h"
+#include "../nogui/msvc_demangler.h"
+#include "../nogui/pe.h"
+#include "../nogui/pe2.h"
+#include "../nogui/scope_exit.h"
+#include "../nogui/search_plan.h"
+#include "../nogui/smart_handle.h"
+
+#include <array>
+#include <cstring>
+#include <cwchar>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+
+#include "../nogui/my_windows.h"
+
+#include <shellapi.h>
+
+
+#define s_very_big_int (2'147'483'647)
+
+
+static void test_search_order();
+static void test_demangler(pe_import_table_info const& iti, pe_export_table_info const& eti, dbghelp const& dh, allocator& alc);
+static void test_demangler_name(string_handle const& name, dbghelp const& dh, allocator& alc);
+
+
+void test()
+{
+	wchar_t const* const cmd_line = GetCommandLineW();
+	int argc;
+	wchar_t** const argv = CommandLineToArgvW(cmd_line, &argc);
+	auto const fn_free_argv = mk::make_scope_exit([&](){ [[maybe_unused]] HLOCAL const freed = LocalFree(argv); assert(freed == nullptr); });
+	if(argc != 3)
+	{
+		return;
+	}
+	if(std::wcsncmp(argv[1], s_cmd_arg_test, std::size(s_cmd_arg_test) - 1) != 0)
+	{
+		return;
+	}
+	test_search_order();
+	dbghelp dh;
+	bool const dh_inited = dh.init();
+	std::filesystem::recursive_directory_iterator dir_it(argv[2], std::filesystem::directory_options::skip_permission_denied);
+	for(auto const& e : dir_it)
+	{
+		auto const& p = e.path();
+		if(std::filesystem::is_directory(p))
+		{
+			continue;
+		}
+		memory_mapped_file const mmf(p.c_str());
+		if(mmf.begin() == nullptr)
+		{
+			continue;
+		}
+		if(mmf.size() < 2)
+		{
+			continue;
+		}
+		if(reinterpret_cast<char const*>(mmf.begin())[0] != 'M')
+		{
+			continue;
+		}
+		if(reinterpret_cast<char const*>(mmf.begin())[1] != 'Z')
+		{
+			continue;
+		}
+		if(mmf.size() < 128)
+		{
+			continue;
+		}
+		std::uint16_t const& new_header_offset = *reinterpret_cast<std::uint16_t const*>(mmf.begin() + 60);
+		if(mmf.size() < new_header_offset + 4)
+		{
+			continue;
+		}
+		std::uint32_t const& new_header_header = *reinterpret_cast<std::uint32_t const*>(mmf.begin() + new_header_offset);
+		if(new_header_header != 0x00004550)
+		{
+			continue;
+		}
+		memory_manager mm;
+		std::uint16_t enpt_count;
+		std::uint16_t const* enpt;
+		allocator enpt_alloc;
+		pe_import_table_info iti;
+		pe_export_table_info eti;
+		pe_tables tables;
+		tables.m_tmp_alc = &enpt_alloc;
+		tables.m_iti_out = &iti;
+		tables.m_eti_out = &eti;
+		tables.m_enpt_count_out = &enpt_count;
+		tables.m_enpt_out = &enpt;
+		bool const tables_processed = pe_process_all(mmf.begin(), mmf.size(), mm, &tables);
+		if(!tables_processed)
+		{
+			OutputDebugStringW(p.c_str());
+			OutputDebugStringW(L"\n");
+			continue;
+		}
+		if(dh_inited)
+		{
+			test_demangler(iti, eti, dh, enpt_alloc);
+		}
+	}
+}
+
+
+void test_search_order()
+{
+	// Synthetic layout, every dependency is present in exactly one place of the search order.
+	static constexpr wchar_t const s_app_dir[] = L"c:\\app";
+	static constexpr wchar_t const s_system32[] = L"c:\\windows\\system32";
+	static constexpr wchar_t const s_windows[] = L"c:\\windows";
+	static constexpr wchar_t const s_current_dir[] = L"c:\\current";
+	static constexpr wchar_t const s_path_1[] = L"c:\\path1";
+	static constexpr wchar_t const s_path_2[] = L"c:\\path2";
+	static constexpr struct { char const* m_dependency; wchar_t const* m_dir; } const s_cases[] =
+	{
+		{"kernel32.dll", s_system32},
+		{"a.dll", s_app_dir},
+		{"b.dll", s_system32},
+		{"c.dll", s_windows},
+		{"d.dll", s_current_dir},
+		{"e.dll", s_path_2},
+		{"f.dll", nullptr},
+	};
+	memory_file_system mfs;
+	mfs.add_file(s_app_dir, static_cast<int>(std::size(s_app_dir) - 1), string{"app.exe", 7});
+	mfs.add_file(s_app_dir, static_cast<int>(std::size(s_app_dir) - 1), string{"a.dll", 5});
+	mfs.add_file(s_system32, static_cast<int>(std::size(s_system32) - 1), string{"a.dll", 5});
+	mfs.add_file(s_system32, static_cast<int>(std::size(s_system32) - 1), string{"b.dll", 5});
+	mfs.add_file(s_windows, static_cast<int>(std::size(s_windows) - 1), string{"b.dll", 5});
+	mfs.add_file(s_windows, static_cast<int>(std::size(s_windows) - 1), string{"c.dll", 5});
+	mfs.add_file(s_current_dir, static_cast<int>(std::size(s_current_dir) - 1), string{"d.dll", 5});
+	mfs.add_file(s_path_2, static_cast<int>(std::size(s_path_2) - 1), string{"d.dll", 5});
+	mfs.add_file(s_path_2, static_cast<int>(std::size(s_path_2) - 1), string{"e.dll", 5});
+	search_plan plan;
+	plan.m_sxs = nullptr;
+	plan.m_sxs_catalog = nullptr;
+	plan.m_api_set = nullptr;
+	plan.m_known_dlls_path = s_system32;
+	plan.m_known_dlls.insert("kernel32.dll");
+	plan.m_system32 = s_system32;
+	plan.m_windows = s_windows;
+	plan.m_current_dir = s_current_dir;
+	plan.m_path_dirs = {s_path_1, s_path_2};
+	plan.m_fs = mfs.get_file_system();
+	std::wstring const main_path = std::wstring{s_app_dir}.append(L"\\app.exe");
+	wstring const main_path_str{main_path.c_str(), static_cast<int>(main_path.size())};
+	dependency_locator dl;
+	dl.m_plan = &plan;
+	dl.m_main_path = wstring_handle{&main_path_str};
+	for(auto const& test_case : s_cases)
+	{
+		string const dependency_str{test_case.m_dependency, static_cast<int>(std::strlen(test_case.m_dependency))};
+		string_handle const dependency{&dependency_str};
+		dl.m_dependency = &dependency;
+		bool const located = locate_dependency(dl);
+		bool const passed = test_case.m_dir ? located && std::filesystem::path{dl.m_result} == std::filesystem::path{test_case.m_dir}.append(test_case.m_dependency) : !located;
+		if(!passed)
+		{
+			OutputDebugStringW(L"Search order mismatch: ");
+			OutputDebugStringA(test_case.m_dependency);
+			OutputDebugStringW(L"\n");
+		}
+	}
+}
+
+void test_demangler(pe_import_table_info const& iti, pe_export_table_info const& eti, dbghelp const& dh, allocator& alc)
+{
+	std::uint16_t const n = iti.m_normal_dll_count + iti.m_delay_dll_count;
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		for(std::uint16_t j = 0; j != iti.m_import_counts[i]; ++j)
+		{
+			if(array_bool_tst(iti.m_are_ordinals[i], j))
+			{
+				continue;
+			}
+			test_demangler_name(iti.m_names[i][j], dh, alc);
+		}
+	}
+	for(std::uint16_t i = 0; i != eti.m_count; ++i)
+	{
+		test_demangler_name(eti.m_names[i], dh, alc);
+	}
+}
+
+void test_demangler_name(string_handle const& name, dbghelp const& dh, allocator& alc)
+{
+	// The native demangler must produce exactly what dbghelp produces for every name it accepts.
+	if(!name.m_string || size(name) == 0 || cbegin(name)[0] != '?')
+	{
+		return;
+	}
+	string native;
+	bool const demangled = msvc_demangle(cbegin(name), size(name), alc, &native);
+	if(!demangled)
+	{
+		return;
+	}
+	std::array<char, 8 * 1024> buff;
+	DWORD const undecorated = dh.m_fn_UnDecorateSymbolName(cbegin(name), buff.data(), static_cast<int>(buff.size()), UNDNAME_COMPLETE);
+	bool const same = undecorated != 0 && static_cast<int>(undecorated) == native.m_len && std::memcmp(buff.data(), native.m_str, native.m_len) == 0;
+	if(!same)
+	{
+		OutputDebugStringW(L"Demangler mismatch: ");
+		OutputDebugStringA(cbegin(name));
+		OutputDebugStringW(L"\n");
+	}
+}
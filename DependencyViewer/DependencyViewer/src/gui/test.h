@@ -1,7 +1,7 @@
-#pragma once
-
-
-static constexpr wchar_t const s_cmd_arg_test[] = L"/test";
-
-
-void test();
+#pragma once
+
+
+static constexpr wchar_t const s_cmd_arg_test[] = L"/test";
+
+
+void test();
@@ -1,50 +1,108 @@
-#include "tree_algos.h"
-
-#include "processor.h"
-
-#include <cstdint>
-
-
-/*
-*
-*                                ( - )
-*                  +---------------+---------------+
-*                ( 1 )                           ( 8 )
-*          +-------+-------+               +-------+-------+
-*        ( 2 )           ( 5 )           ( 9 )           ( 12)
-*      +---+---+       +---+---+       +---+---+       +---+---+
-*    ( 3 )   ( 4 )   ( 6 )   ( 7 )   ( 10)   ( 11)   ( 13)   ( 14)
-*
-*/
-void depth_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data)
-{
-	std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		file_info& child_fi = fi.m_fis[i];
-		callback_fn(child_fi, data);
-		depth_first_visit(child_fi, callback_fn, data);
-	}
-}
-
-/*
-*
-*                                ( - )
-*                  +---------------+---------------+
-*                ( 7 )                           ( 14)
-*          +-------+-------+               +-------+-------+
-*        ( 3 )           ( 6 )           ( 10)           ( 13)
-*      +---+---+       +---+---+       +---+---+       +---+---+
-*    ( 1 )   ( 2 )   ( 4 )   ( 5 )   ( 8 )   ( 9 )   ( 11)   ( 12)
-*
-*/
-void children_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data)
-{
-	std::uint16_t const n = fi.m_import_table.m_normal_dll_count + fi.m_import_table.m_delay_dll_count;
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		file_info& child_fi = fi.m_fis[i];
-		children_first_visit(child_fi, callback_fn, data);
-		callback_fn(child_fi, data);
-	}
-}
+#include "tree_algos.h"
+
+#include "processor.h"
+
+#include "../nogui/cassert_my.h"
+
+#include <cstdint>
+#include <vector>
+
+
+struct tree_algos_frame
+{
+	file_info* m_fi;
+	std::uint16_t m_idx;
+};
+
+
+/*
+*
+*                                ( - )
+*                  +---------------+---------------+
+*                ( 1 )                           ( 8 )
+*          +-------+-------+               +-------+-------+
+*        ( 2 )           ( 5 )           ( 9 )           ( 12)
+*      +---+---+       +---+---+       +---+---+       +---+---+
+*    ( 3 )   ( 4 )   ( 6 )   ( 7 )   ( 10)   ( 11)   ( 13)   ( 14)
+*
+*/
+void depth_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data)
+{
+	std::vector<tree_algos_frame> stack;
+	stack.push_back(tree_algos_frame{&fi, 0});
+	while(!stack.empty())
+	{
+		tree_algos_frame& frame = stack.back();
+		std::uint16_t const n = frame.m_fi->m_import_table.m_normal_dll_count + frame.m_fi->m_import_table.m_delay_dll_count;
+		if(frame.m_idx == n)
+		{
+			stack.pop_back();
+			continue;
+		}
+		file_info& child_fi = frame.m_fi->m_fis[frame.m_idx++];
+		callback_fn(child_fi, data);
+		stack.push_back(tree_algos_frame{&child_fi, 0});
+	}
+}
+
+/*
+*
+*                                ( - )
+*                  +---------------+---------------+
+*                ( 7 )                           ( 14)
+*          +-------+-------+               +-------+-------+
+*        ( 3 )           ( 6 )           ( 10)           ( 13)
+*      +---+---+       +---+---+       +---+---+       +---+---+
+*    ( 1 )   ( 2 )   ( 4 )   ( 5 )   ( 8 )   ( 9 )   ( 11)   ( 12)
+*
+*/
+void children_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data)
+{
+	std::vector<tree_algos_frame> stack;
+	stack.push_back(tree_algos_frame{&fi, 0});
+	while(!stack.empty())
+	{
+		tree_algos_frame& frame = stack.back();
+		std::uint16_t const n = frame.m_fi->m_import_table.m_normal_dll_count + frame.m_fi->m_import_table.m_delay_dll_count;
+		if(frame.m_idx != n)
+		{
+			file_info& child_fi = frame.m_fi->m_fis[frame.m_idx++];
+			stack.push_back(tree_algos_frame{&child_fi, 0});
+			continue;
+		}
+		file_info& done_fi = *frame.m_fi;
+		stack.pop_back();
+		if(!stack.empty())
+		{
+			callback_fn(done_fi, data);
+		}
+	}
+}
+
+/*
+*
+* Same order as depth_first_visit, the root itself is not part of the list.
+*
+*/
+void make_tree_order(file_info& root, allocator& alc, tree_order* const order_out)
+{
+	assert(order_out);
+	tree_order& order = *order_out;
+	std::uint32_t count = 0;
+	static constexpr auto const count_fn = [](file_info&, void* const data)
+	{
+		assert(data);
+		++*static_cast<std::uint32_t*>(data);
+	};
+	depth_first_visit(root, count_fn, &count);
+	order.m_list = alc.allocate_objects<file_info*>(count);
+	order.m_count = 0;
+	static constexpr auto const fill_fn = [](file_info& fi, void* const data)
+	{
+		assert(data);
+		tree_order& order = *static_cast<tree_order*>(data);
+		order.m_list[order.m_count++] = &fi;
+	};
+	depth_first_visit(root, fill_fn, &order);
+	assert(order.m_count == count);
+}
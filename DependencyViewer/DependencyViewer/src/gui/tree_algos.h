@@ -1,8 +1,21 @@
-#pragma once
-
-
-struct file_info;
-
-
-void depth_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data);
-void children_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data);
+#pragma once
+
+
+#include "../nogui/allocator.h"
+
+#include <cstdint>
+
+
+struct file_info;
+
+
+struct tree_order
+{
+	file_info** m_list;
+	std::uint32_t m_count;
+};
+
+
+void depth_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data);
+void children_first_visit(file_info& fi, void(*const callback_fn)(file_info& fi, void* const data), void* const data);
+void make_tree_order(file_info& root, allocator& alc, tree_order* const order_out);
@@ -1,76 +1,87 @@
-#pragma once
-
-
-#include "smart_menu.h"
-
-#include <cstdint>
-#include <string>
-
-#include "../nogui/string_converter.h"
-
-#include "../nogui/my_windows.h"
-
-
-class main_window;
-struct file_info;
-struct htreeitem_s;
-typedef htreeitem_s* htreeitem;
-
-
-class tree_view
-{
-public:
-	tree_view() = delete;
-	tree_view(HWND const parent, main_window& mw);
-	tree_view(tree_view const&) = delete;
-	tree_view(tree_view&&) noexcept = delete;
-	tree_view& operator=(tree_view const&) = delete;
-	tree_view& operator=(tree_view&&) noexcept = delete;
-	~tree_view();
-public:
-	HWND get_hwnd() const;
-	void on_notify(NMHDR& nmhdr);
-	void on_getdispinfow(NMHDR& nmhdr);
-	void on_selchangedw(NMHDR& nmhdr);
-	void on_context_menu(LPARAM const lparam);
-	void on_menu(std::uint16_t const menu_id);
-	void on_menu_match();
-	void on_menu_orig();
-	void on_menu_prev();
-	void on_menu_next();
-	void on_menu_expand();
-	void on_menu_collapse();
-	void on_menu_properties();
-	void on_accel_match();
-	void on_accel_orig();
-	void on_accel_prev();
-	void on_accel_next();
-	void on_accel_expand();
-	void on_accel_collapse();
-	void on_accel_properties();
-	void refresh();
-	void repaint();
-	file_info const* get_selection();
-private:
-	smart_menu create_menu();
-	file_info& htreeitem_2_file_info(htreeitem const& hti);
-	bool get_fi_and_point_for_context_menu(LPARAM const lparam, file_info const*& out_fi, POINT& out_point);
-	std::uint8_t get_tree_item_icon(file_info const& tmp_fi, file_info const* const parent_fi);
-	void refresh_view_recursive(file_info& fi, void* const ti);
-	void select_match(htreeitem const data = nullptr);
-	void select_orig_instance(htreeitem const data = nullptr);
-	void select_prev_instance(htreeitem const data = nullptr);
-	void select_next_instance(htreeitem const data = nullptr);
-	htreeitem get_match_data(file_info const* const curr_fi = nullptr);
-	htreeitem get_orig_data(file_info const* const curr_fi = nullptr);
-	htreeitem get_prev_data(file_info const* const curr_fi = nullptr);
-	htreeitem get_next_data(file_info const* const curr_fi = nullptr);
-	void expand();
-	void collapse();
-	void properties();
-private:
-	HWND const m_hwnd;
-	main_window& m_main_window;
-	smart_menu const m_menu;
-	string_converter m_string_converter;
-};
+#pragma once
+
+
+#include "smart_menu.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../nogui/string_converter.h"
+
+#include "../nogui/my_windows.h"
+
+
+class main_window;
+struct file_info;
+struct processor_tree_record_t;
+struct htreeitem_s;
+typedef htreeitem_s* htreeitem;
+
+
+class tree_view
+{
+public:
+	tree_view() = delete;
+	tree_view(HWND const parent, main_window& mw);
+	tree_view(tree_view const&) = delete;
+	tree_view(tree_view&&) noexcept = delete;
+	tree_view& operator=(tree_view const&) = delete;
+	tree_view& operator=(tree_view&&) noexcept = delete;
+	~tree_view();
+public:
+	HWND get_hwnd() const;
+	void on_notify(NMHDR& nmhdr);
+	void on_getdispinfow(NMHDR& nmhdr);
+	void on_selchangedw(NMHDR& nmhdr);
+	void on_itemexpandingw(NMHDR& nmhdr);
+	void on_context_menu(LPARAM const lparam);
+	void on_menu(std::uint16_t const menu_id);
+	void on_menu_match();
+	void on_menu_orig();
+	void on_menu_prev();
+	void on_menu_next();
+	void on_menu_expand();
+	void on_menu_collapse();
+	void on_menu_properties();
+	void on_accel_match();
+	void on_accel_orig();
+	void on_accel_prev();
+	void on_accel_next();
+	void on_accel_expand();
+	void on_accel_collapse();
+	void on_accel_properties();
+	void refresh();
+	void begin_preview();
+	void add_preview(std::vector<processor_tree_record_t> const& records);
+	void end_preview();
+	void repaint();
+	file_info const* get_selection();
+	htreeitem get_tree_item(file_info const& fi);
+private:
+	smart_menu create_menu();
+	file_info& htreeitem_2_file_info(htreeitem const& hti);
+	bool get_fi_and_point_for_context_menu(LPARAM const lparam, file_info const*& out_fi, POINT& out_point);
+	std::uint8_t get_tree_item_icon(file_info const& tmp_fi, file_info const* const parent_fi);
+	void insert_tree_item(file_info& fi, void* const parent_ti);
+	void insert_children(file_info& fi);
+	void select_match(htreeitem const data = nullptr);
+	void select_orig_instance(htreeitem const data = nullptr);
+	void select_prev_instance(htreeitem const data = nullptr);
+	void select_next_instance(htreeitem const data = nullptr);
+	htreeitem get_match_data(file_info const* const curr_fi = nullptr);
+	htreeitem get_orig_data(file_info const* const curr_fi = nullptr);
+	htreeitem get_prev_data(file_info const* const curr_fi = nullptr);
+	htreeitem get_next_data(file_info const* const curr_fi = nullptr);
+	void expand();
+	void collapse();
+	void properties();
+private:
+	HWND const m_hwnd;
+	main_window& m_main_window;
+	smart_menu const m_menu;
+	string_converter m_string_converter;
+	std::unordered_map<std::uintptr_t, htreeitem> m_preview_items;
+	bool m_preview;
+};
@@ -0,0 +1,222 @@
+#include "api_set.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "pe2.h"
+#include "unicode.h"
+
+#include "pe/coff_full.h"
+#include "pe/pe_util.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+struct api_set_namespace
+{
+	std::uint32_t m_version;
+	std::uint32_t m_size;
+	std::uint32_t m_flags;
+	std::uint32_t m_count;
+	std::uint32_t m_entry_offset;
+	std::uint32_t m_hash_offset;
+	std::uint32_t m_hash_factor;
+};
+static_assert(sizeof(api_set_namespace) == 0x1C, "");
+
+struct api_set_namespace_entry
+{
+	std::uint32_t m_flags;
+	std::uint32_t m_name_offset;
+	std::uint32_t m_name_length;
+	std::uint32_t m_hashed_length;
+	std::uint32_t m_value_offset;
+	std::uint32_t m_value_count;
+};
+static_assert(sizeof(api_set_namespace_entry) == 0x18, "");
+
+struct api_set_value_entry
+{
+	std::uint32_t m_flags;
+	std::uint32_t m_name_offset;
+	std::uint32_t m_name_length;
+	std::uint32_t m_value_offset;
+	std::uint32_t m_value_length;
+};
+static_assert(sizeof(api_set_value_entry) == 0x14, "");
+
+
+static constexpr std::uint32_t const s_api_set_schema_version = 6;
+
+
+static std::mutex g_api_set_schemas_mutex;
+static std::unordered_map<std::wstring, std::unique_ptr<api_set_schema>>* g_api_set_schemas = nullptr;
+
+
+static bool api_set_read_name(std::byte const* const ns, std::uint32_t const ns_size, std::uint32_t const offset, std::uint32_t const length, std::string* const name_out);
+
+
+api_set_schema::api_set_schema() noexcept :
+	m_table()
+{
+}
+
+api_set_schema::~api_set_schema() noexcept
+{
+}
+
+bool api_set_schema::init(wchar_t const* const file_path)
+{
+	assert(file_path);
+	m_table.clear();
+	std::ifstream file{std::filesystem::path{file_path}, std::ios::in | std::ios::binary | std::ios::ate};
+	WARN_M_R(file.is_open(), L"Failed to open API set schema.", false);
+	std::streamoff const file_size = file.tellg();
+	WARN_M_R(file_size > 0 && file_size <= 0x7FFF'FFFF, L"API set schema has wrong size.", false);
+	std::vector<std::byte> data(static_cast<std::size_t>(file_size));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(data.data()), file_size);
+	WARN_M_R(file.good(), L"Failed to read API set schema.", false);
+	pe_headers headers;
+	bool const headers_parsed = pe_process_headers(data.data(), static_cast<int>(data.size()), &headers);
+	WARN_M_R(headers_parsed, L"Failed to pe_process_headers.", false);
+	pe_section_header const* const sct = pe_find_section_by_name(data.data(), ".apiset");
+	WARN_M_R(sct, L"API set section not found.", false);
+	WARN_M_R(sct->m_raw_ptr <= data.size() && sct->m_raw_size <= data.size() - sct->m_raw_ptr, L"API set section out of bounds.", false);
+	WARN_M_R(sct->m_raw_size >= sizeof(api_set_namespace), L"API set section too small.", false);
+	std::byte const* const ns = data.data() + sct->m_raw_ptr;
+	api_set_namespace const& hdr = *reinterpret_cast<api_set_namespace const*>(ns);
+	// Older schemas (Windows 7, 8 and 8.1) use different layouts and are not supported.
+	WARN_M_R(hdr.m_version == s_api_set_schema_version, L"Unsupported API set schema version.", false);
+	std::uint32_t const ns_size = std::min(hdr.m_size, sct->m_raw_size);
+	WARN_M_R(hdr.m_entry_offset <= ns_size && hdr.m_count <= (ns_size - hdr.m_entry_offset) / sizeof(api_set_namespace_entry), L"API set entries out of bounds.", false);
+	api_set_namespace_entry const* const entries = reinterpret_cast<api_set_namespace_entry const*>(ns + hdr.m_entry_offset);
+	m_table.reserve(hdr.m_count);
+	std::string name;
+	std::string host;
+	for(std::uint32_t i = 0; i != hdr.m_count; ++i)
+	{
+		api_set_namespace_entry const& entry = entries[i];
+		bool const name_read = api_set_read_name(ns, ns_size, entry.m_name_offset, std::min(entry.m_hashed_length, entry.m_name_length), &name);
+		WARN_M_R(name_read, L"Failed to api_set_read_name.", false);
+		WARN_M_R(entry.m_value_offset <= ns_size && entry.m_value_count <= (ns_size - entry.m_value_offset) / sizeof(api_set_value_entry), L"API set values out of bounds.", false);
+		api_set_value_entry const* const values = reinterpret_cast<api_set_value_entry const*>(ns + entry.m_value_offset);
+		// Host exceptions for particular importers are not represented, the default host applies to everyone.
+		api_set_value_entry const* const values_end = values + entry.m_value_count;
+		api_set_value_entry const* const default_value = std::find_if(values, values_end, [](api_set_value_entry const& e){ return e.m_name_length == 0; });
+		api_set_value_entry const* const value = default_value != values_end ? default_value : entry.m_value_count != 0 ? values : nullptr;
+		host.clear();
+		if(value && value->m_value_length != 0)
+		{
+			bool const host_read = api_set_read_name(ns, ns_size, value->m_value_offset, value->m_value_length, &host);
+			WARN_M_R(host_read, L"Failed to api_set_read_name.", false);
+		}
+		m_table.emplace(name, host);
+	}
+	return true;
+}
+
+bool api_set_schema::resolve(string const& dll_name, string* const host_out) const
+{
+	assert(host_out);
+	if(!is_api_set_name(dll_name))
+	{
+		return false;
+	}
+	char buff[256];
+	int len = std::min(dll_name.m_len, static_cast<int>(std::size(buff)));
+	std::transform(dll_name.m_str, dll_name.m_str + len, buff, [](char const& ch){ return to_lowercase(ch); });
+	if(len >= 4 && std::string_view{buff + len - 4, 4} == ".dll")
+	{
+		len -= 4;
+	}
+	std::string_view const contract{buff, static_cast<std::size_t>(len)};
+	std::size_t const last_hyphen = contract.rfind('-');
+	if(last_hyphen == std::string_view::npos)
+	{
+		return false;
+	}
+	auto const it = m_table.find(contract.substr(0, last_hyphen));
+	if(it == m_table.end())
+	{
+		return false;
+	}
+	*host_out = it->second.empty() ? string{nullptr, 0} : string{it->second.c_str(), static_cast<int>(it->second.size())};
+	return true;
+}
+
+int api_set_schema::get_count() const
+{
+	return static_cast<int>(m_table.size());
+}
+
+
+bool is_api_set_name(string const& dll_name)
+{
+	if(dll_name.m_len < 4)
+	{
+		return false;
+	}
+	char prefix[4];
+	std::transform(dll_name.m_str, dll_name.m_str + 4, prefix, [](char const& ch){ return to_lowercase(ch); });
+	std::string_view const view{prefix, 4};
+	return view == "api-" || view == "ext-";
+}
+
+
+void api_set_schemas::deinit()
+{
+	std::lock_guard<std::mutex> const lck(g_api_set_schemas_mutex);
+	if(g_api_set_schemas)
+	{
+		delete g_api_set_schemas;
+		g_api_set_schemas = nullptr;
+	}
+}
+
+api_set_schema const* api_set_schemas::get(std::wstring const& system32)
+{
+	std::wstring key(system32.size(), L'\0');
+	std::transform(system32.begin(), system32.end(), key.begin(), [](wchar_t const& ch){ return to_lowercase(ch); });
+	std::lock_guard<std::mutex> const lck(g_api_set_schemas_mutex);
+	if(!g_api_set_schemas)
+	{
+		g_api_set_schemas = new std::unordered_map<std::wstring, std::unique_ptr<api_set_schema>>();
+	}
+	auto const it = g_api_set_schemas->find(key);
+	if(it != g_api_set_schemas->end())
+	{
+		return it->second.get();
+	}
+	std::unique_ptr<api_set_schema> schema = std::make_unique<api_set_schema>();
+	std::wstring const file_path = std::filesystem::path{system32}.append(L"apisetschema.dll").wstring();
+	bool const inited = schema->init(file_path.c_str());
+	if(!inited)
+	{
+		schema.reset();
+	}
+	return g_api_set_schemas->emplace(std::move(key), std::move(schema)).first->second.get();
+}
+
+
+bool api_set_read_name(std::byte const* const ns, std::uint32_t const ns_size, std::uint32_t const offset, std::uint32_t const length, std::string* const name_out)
+{
+	assert(name_out);
+	WARN_M_R(offset <= ns_size && length <= ns_size - offset && length % 2 == 0, L"API set name out of bounds.", false);
+	name_out->resize(length / 2);
+	for(std::uint32_t i = 0; i != length / 2; ++i)
+	{
+		std::uint16_t ch;
+		std::memcpy(&ch, ns + offset + i * 2, sizeof(ch));
+		WARN_M_R(ch < 0x80, L"API set name is not ASCII.", false);
+		(*name_out)[i] = to_lowercase(static_cast<char>(ch));
+	}
+	return true;
+}
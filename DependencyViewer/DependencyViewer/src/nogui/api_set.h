@@ -0,0 +1,43 @@
+#pragma once
+
+
+#include "my_string.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+struct api_set_hash
+{
+	using is_transparent = void;
+	std::size_t operator()(std::string_view const str) const { return std::hash<std::string_view>{}(str); }
+};
+
+
+class api_set_schema
+{
+public:
+	api_set_schema() noexcept;
+	api_set_schema(api_set_schema const&) = delete;
+	api_set_schema& operator=(api_set_schema const&) = delete;
+	~api_set_schema() noexcept;
+public:
+	bool init(wchar_t const* const file_path);
+	bool resolve(string const& dll_name, string* const host_out) const;
+	int get_count() const;
+private:
+	std::unordered_map<std::string, std::string, api_set_hash, std::equal_to<>> m_table;
+};
+
+
+bool is_api_set_name(string const& dll_name);
+
+
+namespace api_set_schemas
+{
+	void deinit();
+	api_set_schema const* get(std::wstring const& system32);
+}
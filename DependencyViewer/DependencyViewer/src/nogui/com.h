@@ -1,13 +1,13 @@
-#pragma once
-
-
-class com
-{
-public:
-	com();
-	com(com const&) = delete;
-	com(com&&) noexcept = delete;
-	com& operator=(com const&) = delete;
-	com& operator=(com&&) noexcept = delete;
-	~com();
-};
+#pragma once
+
+
+class com
+{
+public:
+	com();
+	com(com const&) = delete;
+	com(com&&) noexcept = delete;
+	com& operator=(com const&) = delete;
+	com& operator=(com&&) noexcept = delete;
+	~com();
+};
@@ -1,172 +1,336 @@
-#include "dbg_provider.h"
-
-#include "cassert_my.h"
-#include "scope_exit.h"
-#include "thread_name.h"
-
-#include <array>
-
-
-static dbg_provider* g_dbg_provider = nullptr;
-
-
-void dbg_provider::deinit()
-{
-	delete g_dbg_provider;
-	g_dbg_provider = nullptr;
-}
-
-dbg_provider* dbg_provider::get()
-{
-	if(!g_dbg_provider)
-	{
-		g_dbg_provider = new dbg_provider();
-	}
-	return g_dbg_provider;
-}
-
-dbg_provider::dbg_provider() :
-	m_sym_inited(false),
-	m_dbghelp(),
-	m_thread_worker()
-{
-	static constexpr auto const init_task = [](thread_worker_param_t const param)
-	{
-		assert(param);
-		dbg_provider& self = *static_cast<dbg_provider*>(param);
-		self.init_task();
-	};
-	thread_worker_function_t const init_tsk = init_task;
-	thread_worker_param_t const init_tsk_param = this;
-
-	add_task(init_tsk, init_tsk_param);
-}
-
-dbg_provider::~dbg_provider()
-{
-	static constexpr auto const deinit_task = [](thread_worker_param_t const param)
-	{
-		assert(param);
-		dbg_provider& self = *static_cast<dbg_provider*>(param);
-		self.deinit_task();
-	};
-	thread_worker_function_t const deinit_tsk = deinit_task;
-	thread_worker_param_t const deinit_tsk_param = this;
-
-	add_task(deinit_tsk, deinit_tsk_param);
-}
-
-void dbg_provider::add_task(thread_worker_function_t const func, thread_worker_param_t const param)
-{
-	m_thread_worker.add_task(func, param);
-}
-
-void dbg_provider::get_symbols_from_addresses_task(symbols_from_addresses_param_t& param)
-{
-	if(!m_sym_inited)
-	{
-		return;
-	}
-	DWORD64 const sym_module = m_dbghelp.m_fn_SymLoadModuleExW(GetCurrentProcess(), nullptr, cbegin(param.m_module_path), nullptr, 0, 0, nullptr, 0);
-	if(sym_module == 0)
-	{
-		return;
-	}
-	auto const fn_unload_module = mk::make_scope_exit([&]()
-	{
-		BOOL const unloaded = m_dbghelp.m_fn_SymUnloadModule64(GetCurrentProcess(), sym_module);
-		assert(unloaded != FALSE);
-	});
-	assert(param.m_indexes.size() == param.m_strings.size());
-	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		DWORD64 displacement;
-		union symbol_info_t
-		{
-			SYMBOL_INFO sym_info;
-			char buff[sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(char)];
-		};
-		symbol_info_t symbol_info_v{};
-		SYMBOL_INFO& symbol_info = symbol_info_v.sym_info;
-		symbol_info.SizeOfStruct = sizeof(symbol_info);
-		symbol_info.MaxNameLen = MAX_SYM_NAME;
-		std::uint32_t const& address = param.m_eti->m_rvas_or_forwarders[param.m_indexes[i]].m_rva;
-		DWORD64 const address64 = sym_module + address;
-		BOOL const got_sym = m_dbghelp.m_fn_SymFromAddr(GetCurrentProcess(), address64, &displacement, &symbol_info);
-		if(got_sym != FALSE)
-		{
-			param.m_strings[i].assign(symbol_info.Name, symbol_info.Name + symbol_info.NameLen);
-		}
-	}
-}
-
-void dbg_provider::get_undecorated_from_decorated_e_task(undecorated_from_decorated_e_param_t& param)
-{
-	if(!m_sym_inited)
-	{
-		return;
-	}
-	assert(param.m_indexes.size() == param.m_strings.size());
-	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		std::uint16_t const idx = param.m_indexes[i];
-		string_handle const& name = param.m_eti->m_names[idx];
-		std::array<char, 8 * 1024> buff;
-		DWORD const undecorated = m_dbghelp.m_fn_UnDecorateSymbolName(cbegin(name), buff.data(), static_cast<int>(buff.size()), UNDNAME_COMPLETE);
-		if(undecorated != 0)
-		{
-			param.m_strings[i].assign(buff.data(), buff.data() + undecorated);
-		}
-	}
-}
-
-void dbg_provider::get_undecorated_from_decorated_i_task(undecorated_from_decorated_i_param_t& param)
-{
-	if(!m_sym_inited)
-	{
-		return;
-	}
-	assert(param.m_indexes.size() == param.m_strings.size());
-	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
-	for(std::uint16_t i = 0; i != n; ++i)
-	{
-		std::uint16_t const idx = param.m_indexes[i];
-		string_handle const& name = param.m_iti->m_names[param.m_dll_idx][idx];
-		std::array<char, 8 * 1024> buff;
-		DWORD const undecorated = m_dbghelp.m_fn_UnDecorateSymbolName(cbegin(name), buff.data(), static_cast<int>(buff.size()), UNDNAME_COMPLETE);
-		if(undecorated != 0)
-		{
-			param.m_strings[i].assign(buff.data(), buff.data() + undecorated);
-		}
-	}
-}
-
-void dbg_provider::init_task()
-{
-	name_current_thread("dbg_provider", L"dbg_provider");
-	bool const dbghelp_inited = m_dbghelp.init();
-	if(!dbghelp_inited)
-	{
-		return;
-	}
-	DWORD const sym_options = m_dbghelp.m_fn_SymGetOptions();
-	DWORD const set = m_dbghelp.m_fn_SymSetOptions((sym_options | SYMOPT_DEFERRED_LOADS | SYMOPT_FAIL_CRITICAL_ERRORS | SYMOPT_PUBLICS_ONLY) &~ SYMOPT_UNDNAME);
-	BOOL const inited = m_dbghelp.m_fn_SymInitializeW(GetCurrentProcess(), nullptr, FALSE);
-	if(inited == FALSE)
-	{
-		return;
-	}
-	m_sym_inited = true;
-}
-
-void dbg_provider::deinit_task()
-{
-	if(m_sym_inited)
-	{
-		BOOL const cleaned = m_dbghelp.m_fn_SymCleanup(GetCurrentProcess());
-		assert(cleaned != FALSE);
-	}
-	m_dbghelp.deinit();
-}
+#include "dbg_provider.h"
+
+#include "allocator.h"
+#include "cassert_my.h"
+#include "memory_mapped_file.h"
+#include "msvc_demangler.h"
+#include "parallel_for.h"
+#include "pdb_publics.h"
+#include "scope_exit.h"
+#include "thread_name.h"
+#include "unicode.h"
+#include "utils.h"
+
+#include "pe/debug_table.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <numeric>
+
+
+struct dbg_provider_demangle_state
+{
+	string_handle const* const* m_names;
+	std::vector<std::string>* m_strings;
+	int m_count;
+};
+
+
+static constexpr int const s_dbg_provider_demangle_chunk = 64;
+static dbg_provider* g_dbg_provider = nullptr;
+
+
+static void dbg_provider_demangle(std::vector<string_handle const*> const& names, std::vector<std::string>& strings);
+static void dbg_provider_resolve_publics(symbols_from_addresses_param_t& param);
+static std::vector<std::wstring> dbg_provider_pdb_candidates(wstring_handle const& module_path, pe_pdb_info const& pdb_info);
+
+
+void dbg_provider::deinit()
+{
+	delete g_dbg_provider;
+	g_dbg_provider = nullptr;
+}
+
+dbg_provider* dbg_provider::get()
+{
+	if(!g_dbg_provider)
+	{
+		g_dbg_provider = new dbg_provider();
+	}
+	return g_dbg_provider;
+}
+
+dbg_provider::dbg_provider() :
+	m_sym_inited(false),
+	m_dbghelp(),
+	m_thread_worker()
+{
+	static constexpr auto const init_task = [](thread_worker_param_t const param)
+	{
+		assert(param);
+		dbg_provider& self = *static_cast<dbg_provider*>(param);
+		self.init_task();
+	};
+	thread_worker_function_t const init_tsk = init_task;
+	thread_worker_param_t const init_tsk_param = this;
+
+	add_task(init_tsk, init_tsk_param);
+}
+
+dbg_provider::~dbg_provider()
+{
+	static constexpr auto const deinit_task = [](thread_worker_param_t const param)
+	{
+		assert(param);
+		dbg_provider& self = *static_cast<dbg_provider*>(param);
+		self.deinit_task();
+	};
+	thread_worker_function_t const deinit_tsk = deinit_task;
+	thread_worker_param_t const deinit_tsk_param = this;
+
+	add_task(deinit_tsk, deinit_tsk_param);
+}
+
+void dbg_provider::add_task(thread_worker_function_t const func, thread_worker_param_t const param)
+{
+	m_thread_worker.add_task(func, param);
+}
+
+void dbg_provider::get_symbols_from_addresses_task(symbols_from_addresses_param_t& param)
+{
+	assert(param.m_indexes.size() == param.m_strings.size());
+	dbg_provider_resolve_publics(param);
+	bool const all_resolved = std::all_of(param.m_strings.begin(), param.m_strings.end(), [](std::string const& e){ return !e.empty(); });
+	if(!m_sym_inited || all_resolved)
+	{
+		return;
+	}
+	DWORD64 const sym_module = m_dbghelp.m_fn_SymLoadModuleExW(GetCurrentProcess(), nullptr, cbegin(param.m_module_path), nullptr, 0, 0, nullptr, 0);
+	if(sym_module == 0)
+	{
+		return;
+	}
+	auto const fn_unload_module = mk::make_scope_exit([&]()
+	{
+		BOOL const unloaded = m_dbghelp.m_fn_SymUnloadModule64(GetCurrentProcess(), sym_module);
+		assert(unloaded != FALSE);
+	});
+	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		if(!param.m_strings[i].empty())
+		{
+			continue;
+		}
+		DWORD64 displacement;
+		union symbol_info_t
+		{
+			SYMBOL_INFO sym_info;
+			char buff[sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(char)];
+		};
+		symbol_info_t symbol_info_v{};
+		SYMBOL_INFO& symbol_info = symbol_info_v.sym_info;
+		symbol_info.SizeOfStruct = sizeof(symbol_info);
+		symbol_info.MaxNameLen = MAX_SYM_NAME;
+		std::uint32_t const& address = param.m_eti->m_rvas_or_forwarders[param.m_indexes[i]].m_rva;
+		DWORD64 const address64 = sym_module + address;
+		BOOL const got_sym = m_dbghelp.m_fn_SymFromAddr(GetCurrentProcess(), address64, &displacement, &symbol_info);
+		if(got_sym != FALSE)
+		{
+			param.m_strings[i].assign(symbol_info.Name, symbol_info.Name + symbol_info.NameLen);
+		}
+	}
+}
+
+void dbg_provider::get_undecorated_from_decorated_e_task(undecorated_from_decorated_e_param_t& param)
+{
+	assert(param.m_indexes.size() == param.m_strings.size());
+	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
+	std::vector<string_handle const*> names(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		names[i] = &param.m_eti->m_names[param.m_indexes[i]];
+	}
+	if(!m_sym_inited)
+	{
+		dbg_provider_demangle(names, param.m_strings);
+		return;
+	}
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		string_handle const& name = *names[i];
+		std::array<char, 8 * 1024> buff;
+		DWORD const undecorated = m_dbghelp.m_fn_UnDecorateSymbolName(cbegin(name), buff.data(), static_cast<int>(buff.size()), UNDNAME_COMPLETE);
+		if(undecorated != 0)
+		{
+			param.m_strings[i].assign(buff.data(), buff.data() + undecorated);
+		}
+	}
+}
+
+void dbg_provider::get_undecorated_from_decorated_i_task(undecorated_from_decorated_i_param_t& param)
+{
+	assert(param.m_indexes.size() == param.m_strings.size());
+	std::uint16_t const n = static_cast<std::uint16_t>(param.m_indexes.size());
+	std::vector<string_handle const*> names(n);
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		names[i] = &param.m_iti->m_names[param.m_dll_idx][param.m_indexes[i]];
+	}
+	if(!m_sym_inited)
+	{
+		dbg_provider_demangle(names, param.m_strings);
+		return;
+	}
+	for(std::uint16_t i = 0; i != n; ++i)
+	{
+		string_handle const& name = *names[i];
+		std::array<char, 8 * 1024> buff;
+		DWORD const undecorated = m_dbghelp.m_fn_UnDecorateSymbolName(cbegin(name), buff.data(), static_cast<int>(buff.size()), UNDNAME_COMPLETE);
+		if(undecorated != 0)
+		{
+			param.m_strings[i].assign(buff.data(), buff.data() + undecorated);
+		}
+	}
+}
+
+void dbg_provider::init_task()
+{
+	name_current_thread("dbg_provider", L"dbg_provider");
+	bool const dbghelp_inited = m_dbghelp.init();
+	if(!dbghelp_inited)
+	{
+		return;
+	}
+	DWORD const sym_options = m_dbghelp.m_fn_SymGetOptions();
+	DWORD const set = m_dbghelp.m_fn_SymSetOptions((sym_options | SYMOPT_DEFERRED_LOADS | SYMOPT_FAIL_CRITICAL_ERRORS | SYMOPT_PUBLICS_ONLY) &~ SYMOPT_UNDNAME);
+	BOOL const inited = m_dbghelp.m_fn_SymInitializeW(GetCurrentProcess(), nullptr, FALSE);
+	if(inited == FALSE)
+	{
+		return;
+	}
+	m_sym_inited = true;
+}
+
+void dbg_provider::deinit_task()
+{
+	if(m_sym_inited)
+	{
+		BOOL const cleaned = m_dbghelp.m_fn_SymCleanup(GetCurrentProcess());
+		assert(cleaned != FALSE);
+	}
+	m_dbghelp.deinit();
+}
+
+
+void dbg_provider_demangle(std::vector<string_handle const*> const& names, std::vector<std::string>& strings)
+{
+	assert(names.size() == strings.size());
+	static constexpr auto const demangle_fn = [](int const idx, [[maybe_unused]] int const worker_idx, parallel_for_param_t const param)
+	{
+		assert(param);
+		dbg_provider_demangle_state const& ds = *static_cast<dbg_provider_demangle_state const*>(param);
+		int const begin = idx * s_dbg_provider_demangle_chunk;
+		int const end = (std::min)(begin + s_dbg_provider_demangle_chunk, ds.m_count);
+		allocator alc;
+		for(int i = begin; i != end; ++i)
+		{
+			string_handle const& name = *ds.m_names[i];
+			string undecorated;
+			bool const demangled = msvc_demangle(cbegin(name), size(name), alc, &undecorated);
+			if(demangled)
+			{
+				(*ds.m_strings)[i].assign(undecorated.m_str, undecorated.m_str + undecorated.m_len);
+			}
+		}
+	};
+	dbg_provider_demangle_state ds;
+	ds.m_names = names.data();
+	ds.m_strings = &strings;
+	ds.m_count = static_cast<int>(names.size());
+	parallel_for((ds.m_count + s_dbg_provider_demangle_chunk - 1) / s_dbg_provider_demangle_chunk, demangle_fn, &ds);
+}
+
+void dbg_provider_resolve_publics(symbols_from_addresses_param_t& param)
+{
+	memory_mapped_file const mmf{cbegin(param.m_module_path)};
+	if(!mmf.begin())
+	{
+		return;
+	}
+	pe_pdb_info pdb_info;
+	bool const parsed = pe_parse_debug_pdb_info(mmf.begin(), mmf.size(), &pdb_info);
+	if(!parsed || pdb_info.m_pdb_path.m_len == 0)
+	{
+		return;
+	}
+	std::vector<std::wstring> const candidates = dbg_provider_pdb_candidates(param.m_module_path, pdb_info);
+	pdb_publics const* const publics = pdb_publics_cache::get(pdb_info.m_guid, pdb_info.m_age, candidates);
+	if(!publics)
+	{
+		return;
+	}
+	int const n = static_cast<int>(param.m_indexes.size());
+	std::vector<int> order(n);
+	std::iota(order.begin(), order.end(), 0);
+	auto const fn_rva = [&](int const& i){ return param.m_eti->m_rvas_or_forwarders[param.m_indexes[i]].m_rva; };
+	std::sort(order.begin(), order.end(), [&](int const& a, int const& b){ return fn_rva(a) < fn_rva(b); });
+	std::vector<std::uint32_t> rvas(n);
+	std::transform(order.begin(), order.end(), rvas.begin(), fn_rva);
+	std::vector<string> names(n);
+	publics->resolve(rvas.data(), n, names.data());
+	for(int i = 0; i != n; ++i)
+	{
+		if(names[i].m_len != 0)
+		{
+			param.m_strings[order[i]].assign(names[i].m_str, names[i].m_str + names[i].m_len);
+		}
+	}
+}
+
+std::vector<std::wstring> dbg_provider_pdb_candidates(wstring_handle const& module_path, pe_pdb_info const& pdb_info)
+{
+	std::vector<std::wstring> candidates;
+	if(!is_ascii(pdb_info.m_pdb_path.m_str, pdb_info.m_pdb_path.m_len))
+	{
+		return candidates;
+	}
+	std::wstring const pdb_path{pdb_info.m_pdb_path.m_str, pdb_info.m_pdb_path.m_str + pdb_info.m_pdb_path.m_len};
+	std::wstring const pdb_name{find_file_name(pdb_path.c_str(), static_cast<int>(pdb_path.size()))};
+	candidates.push_back(pdb_path);
+	wchar_t const* const module_name = find_file_name(cbegin(module_path), size(module_path));
+	candidates.push_back(std::wstring{cbegin(module_path), module_name} + pdb_name);
+
+	std::array<wchar_t, 40> signature_buff;
+	std::uint8_t const* const g = pdb_info.m_guid;
+	int const printed = std::swprintf(signature_buff.data(), signature_buff.size(), L"%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%X", g[3], g[2], g[1], g[0], g[5], g[4], g[7], g[6], g[8], g[9], g[10], g[11], g[12], g[13], g[14], g[15], static_cast<unsigned>(pdb_info.m_age));
+	assert(printed > 0 && printed < static_cast<int>(signature_buff.size()));
+	std::wstring const signature{signature_buff.data(), signature_buff.data() + printed};
+
+	std::array<wchar_t, 32 * 1024> buff;
+	DWORD const got_env = GetEnvironmentVariableW(L"_NT_SYMBOL_PATH", buff.data(), static_cast<int>(buff.size()));
+	if(got_env == 0 || got_env >= buff.size())
+	{
+		return candidates;
+	}
+	std::wstring_view const symbol_path{buff.data(), got_env};
+	std::size_t pos = 0;
+	while(pos < symbol_path.size())
+	{
+		std::size_t const sep = (std::min)(symbol_path.find(L';', pos), symbol_path.size());
+		std::wstring_view const element = symbol_path.substr(pos, sep - pos);
+		pos = sep + 1;
+		std::size_t part_pos = 0;
+		bool is_first = true;
+		while(part_pos < element.size())
+		{
+			std::size_t const star = (std::min)(element.find(L'*', part_pos), element.size());
+			std::wstring_view const part = element.substr(part_pos, star - part_pos);
+			part_pos = star + 1;
+			bool const is_keyword = is_first && star != element.size();
+			is_first = false;
+			bool const is_url = part.size() >= 4 && std::equal(part.begin(), part.begin() + 4, L"http", [](wchar_t const& a, wchar_t const& b){ return to_lowercase(a) == b; });
+			if(is_keyword || is_url || part.empty())
+			{
+				continue;
+			}
+			std::filesystem::path const dir{part};
+			candidates.push_back(std::filesystem::path{dir}.append(pdb_name).append(signature).append(pdb_name).wstring());
+			candidates.push_back(std::filesystem::path{dir}.append(pdb_name).wstring());
+		}
+	}
+	return candidates;
+}
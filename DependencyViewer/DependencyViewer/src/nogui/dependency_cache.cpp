@@ -0,0 +1,104 @@
+#include "dependency_cache.h"
+
+#include "cassert_my.h"
+#include "fnv1a.h"
+#include "utils.h"
+
+
+std::size_t dependency_cache_key_hash::operator()(dependency_cache_key const& obj) const
+{
+	fnv1a_state hash;
+	fnv1a_hash_init(hash);
+	for(char const& e : obj.m_dependency)
+	{
+		char const ch = (e | 0b0010'0000);
+		fnv1a_hash_process(hash, &ch, sizeof(ch));
+	}
+	for(wchar_t const& e : obj.m_app_dir)
+	{
+		wchar_t const ch = (e | 0b0010'0000);
+		fnv1a_hash_process(hash, &ch, sizeof(ch));
+	}
+	fnv1a_hash_process(hash, obj.m_actctx_module.m_str, obj.m_actctx_module.m_len * sizeof(wchar_t));
+	fnv1a_hash_process(hash, &obj.m_actctx_manifest_id, sizeof(obj.m_actctx_manifest_id));
+	return fnv1a_hash_finish(hash);
+}
+
+bool dependency_cache_key_equal::operator()(dependency_cache_key const& a, dependency_cache_key const& b) const
+{
+	return
+		a.m_actctx_manifest_id == b.m_actctx_manifest_id &&
+		string_case_insensitive_equal{}(a.m_dependency, b.m_dependency) &&
+		wstring_case_insensitive_equal{}(a.m_app_dir, b.m_app_dir) &&
+		wstring_equal{}(a.m_actctx_module, b.m_actctx_module);
+}
+
+
+dependency_cache::dependency_cache() noexcept :
+	m_mutex(),
+	m_map(),
+	m_alc(),
+	m_wstrs(),
+	m_hits(0),
+	m_misses(0)
+{
+}
+
+dependency_cache::~dependency_cache() noexcept
+{
+}
+
+bool dependency_cache::find(dependency_cache_key const& key, dependency_cache_value* const value_out)
+{
+	assert(value_out);
+	{
+		std::lock_guard<std::mutex> const lck(m_mutex);
+		auto const it = m_map.find(key);
+		if(it != m_map.end())
+		{
+			*value_out = it->second;
+			++m_hits;
+			return true;
+		}
+	}
+	++m_misses;
+	return false;
+}
+
+dependency_cache_value dependency_cache::insert(dependency_cache_key const& key, bool const located, wchar_t const* const result, int const result_len)
+{
+	std::lock_guard<std::mutex> const lck(m_mutex);
+	auto const it = m_map.find(key);
+	if(it != m_map.end())
+	{
+		return it->second;
+	}
+	dependency_cache_value value;
+	value.m_located = located;
+	value.m_result = located ? m_wstrs.add_string(result, result_len, m_alc) : wstring_handle{};
+	m_map.emplace(key, value);
+	return value;
+}
+
+int dependency_cache::get_hits() const
+{
+	return m_hits;
+}
+
+int dependency_cache::get_misses() const
+{
+	return m_misses;
+}
+
+
+dependency_cache_key make_dependency_cache_key(string_handle const& dependency, wstring_handle const& main_path, wstring_handle const& module_path, std::uint32_t const manifest_id, bool const external_manifest)
+{
+	wchar_t const* const main_path_str = main_path.m_string->m_str;
+	wchar_t const* const file_name = find_file_name(main_path_str, main_path.m_string->m_len);
+	dependency_cache_key key;
+	key.m_dependency = *dependency.m_string;
+	key.m_app_dir = wstring{main_path_str, static_cast<int>(file_name - main_path_str)};
+	key.m_actctx_module = manifest_id != 0 ? *module_path.m_string : external_manifest ? *main_path.m_string : wstring{nullptr, 0};
+	key.m_actctx_manifest_id = manifest_id;
+	return key;
+}
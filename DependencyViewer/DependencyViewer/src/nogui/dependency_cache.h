@@ -0,0 +1,63 @@
+#pragma once
+
+
+#include "allocator.h"
+#include "my_string.h"
+#include "my_string_handle.h"
+#include "unique_strings.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+
+struct dependency_cache_key
+{
+	string m_dependency;
+	wstring m_app_dir;
+	wstring m_actctx_module;
+	std::uint32_t m_actctx_manifest_id;
+};
+
+struct dependency_cache_key_hash
+{
+	std::size_t operator()(dependency_cache_key const& obj) const;
+};
+
+struct dependency_cache_key_equal
+{
+	bool operator()(dependency_cache_key const& a, dependency_cache_key const& b) const;
+};
+
+struct dependency_cache_value
+{
+	bool m_located;
+	wstring_handle m_result;
+};
+
+
+class dependency_cache
+{
+public:
+	dependency_cache() noexcept;
+	dependency_cache(dependency_cache const&) = delete;
+	dependency_cache& operator=(dependency_cache const&) = delete;
+	~dependency_cache() noexcept;
+public:
+	bool find(dependency_cache_key const& key, dependency_cache_value* const value_out);
+	dependency_cache_value insert(dependency_cache_key const& key, bool const located, wchar_t const* const result, int const result_len);
+	int get_hits() const;
+	int get_misses() const;
+private:
+	std::mutex m_mutex;
+	std::unordered_map<dependency_cache_key, dependency_cache_value, dependency_cache_key_hash, dependency_cache_key_equal> m_map;
+	allocator m_alc;
+	wunique_strings m_wstrs;
+	std::atomic<int> m_hits;
+	std::atomic<int> m_misses;
+};
+
+
+dependency_cache_key make_dependency_cache_key(string_handle const& dependency, wstring_handle const& main_path, wstring_handle const& module_path, std::uint32_t const manifest_id, bool const external_manifest);
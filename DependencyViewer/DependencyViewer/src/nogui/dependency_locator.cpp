@@ -1,172 +1,234 @@
-#include "dependency_locator.h"
-
-#include "assert_my.h"
-#include "cassert_my.h"
-#include "known_dlls.h"
-#include "unicode.h"
-
-#include <algorithm>
-#include <array>
-
-#include "my_windows.h"
-
-
-bool locate_dependency(dependency_locator& self)
-{
-	if(locate_dependency_sxs(self)) return true;
-	if(locate_dependency_known_dlls(self)) return true;
-	if(locate_dependency_application_dir(self)) return true;
-	if(locate_dependency_system32(self)) return true;
-	if(locate_dependency_system16(self)) return true;
-	if(locate_dependency_windows(self)) return true;
-	if(locate_dependency_current_dir(self)) return true;
-	if(locate_dependency_environment_path(self)) return true;
-	return false;
-}
-
-
-bool locate_dependency_sxs(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	ACTCTX_SECTION_KEYED_DATA actctx_section_keyed_data{};
-	actctx_section_keyed_data.cbSize = sizeof(actctx_section_keyed_data);
-	BOOL const actctx_data_found = FindActCtxSectionStringA(0, nullptr, ACTIVATION_CONTEXT_SECTION_DLL_REDIRECTION, dependency.m_string->m_str, &actctx_section_keyed_data);
-	if(actctx_data_found == FALSE)
-	{
-		return false;
-	}
-	std::array<wchar_t, 1 * 1024> buff;
-	WARN_M_R(dependency.m_string->m_len < static_cast<int>(buff.size()), L"File name too long.", false);
-	std::transform(begin(dependency), end(dependency), buff.begin(), [](char const& ch) -> wchar_t { return static_cast<wchar_t>(ch); });
-	buff[size(dependency)] = L'\0';
-	self.m_result.resize(32 * 1024);
-	DWORD const found = SearchPathW(nullptr, buff.data(), nullptr, static_cast<int>(self.m_result.size()), self.m_result.data(), nullptr);
-	if(found == 0)
-	{
-		return false;
-	}
-	WARN_M_R(found < self.m_result.size(), L"Path too long.", false);
-	self.m_result.resize(found);
-	return true;
-}
-
-bool locate_dependency_known_dlls(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	std::string& tmpn = self.m_tmpn;
-	self.m_tmpn.resize(size(dependency));
-	std::transform(begin(dependency), end(dependency), begin(tmpn), [](auto const& e){ return to_lowercase(e); });
-	string const dll_name_s{tmpn.c_str(), static_cast<int>(tmpn.size())};
-	auto const& known_dll_names = known_dlls::get_names_sorted_lowercase_ascii();
-	auto const it = std::lower_bound(known_dll_names.begin(), known_dll_names.end(), dll_name_s, [](auto const& e, auto const& v){ string const e_s{e.c_str(), static_cast<int>(e.size())}; return e_s < v; });
-	if(it == known_dll_names.end())
-	{
-		return false;
-	}
-	string const s{it->c_str(), static_cast<int>(it->size())};
-	if(s != dll_name_s)
-	{
-		return false;
-	}
-	self.m_result = std::filesystem::path{known_dlls::get_path()}.append(*it);
-	return true;
-}
-
-bool locate_dependency_application_dir(dependency_locator& self)
-{
-	wstring_handle const& main_path = self.m_main_path;
-	string_handle const& dependency = *self.m_dependency;
-	std::filesystem::path& tmp_path = self.m_tmp_path;
-	tmp_path.assign(begin(main_path), end(main_path)).replace_filename({begin(dependency), end(dependency)});
-	if(!std::filesystem::exists(tmp_path))
-	{
-		return false;
-	}
-	self.m_result = tmp_path;
-	return true;
-}
-
-bool locate_dependency_system32(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	std::filesystem::path& tmp_path = self.m_tmp_path;
-	std::array<wchar_t, 32 * 1024> buff;
-	UINT const got_sys = GetSystemDirectoryW(buff.data(), static_cast<UINT>(buff.size()));
-	assert(got_sys != 0);
-	assert(got_sys < static_cast<UINT>(buff.size()));
-	tmp_path.assign(buff.data(), buff.data() + got_sys).append(begin(dependency), end(dependency));
-	if(!std::filesystem::exists(tmp_path))
-	{
-		return false;
-	}
-	self.m_result = tmp_path;
-	return true;
-}
-
-bool locate_dependency_system16(dependency_locator&)
-{
-	// The 16-bit system directory. There is no function that obtains the path of this directory, but it is searched.
-	return false;
-}
-
-bool locate_dependency_windows(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	std::filesystem::path& tmp_path = self.m_tmp_path;
-	std::array<wchar_t, 32 * 1024> buff;
-	UINT const got_win = GetWindowsDirectoryW(buff.data(), static_cast<UINT>(buff.size()));
-	assert(got_win != 0);
-	assert(got_win < static_cast<UINT>(buff.size()));
-	tmp_path.assign(buff.data(), buff.data() + got_win).append(begin(dependency), end(dependency));
-	if(!std::filesystem::exists(tmp_path))
-	{
-		return false;
-	}
-	self.m_result = tmp_path;
-	return true;
-}
-
-bool locate_dependency_current_dir(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	std::filesystem::path& tmp_path = self.m_tmp_path;
-	std::array<wchar_t, 32 * 1024> buff;
-	DWORD const got_currdir = GetCurrentDirectoryW(static_cast<DWORD>(buff.size()), buff.data());
-	assert(got_currdir != 0);
-	assert(got_currdir < static_cast<DWORD>(buff.size()));
-	tmp_path.assign(buff.data(), buff.data() + got_currdir).append(begin(dependency), end(dependency));
-	if(!std::filesystem::exists(tmp_path))
-	{
-		return false;
-	}
-	self.m_result = tmp_path;
-	return true;
-}
-
-bool locate_dependency_environment_path(dependency_locator& self)
-{
-	string_handle const& dependency = *self.m_dependency;
-	std::filesystem::path& tmp_path = self.m_tmp_path;
-	std::array<wchar_t, 32 * 1024> buff;
-	DWORD const got_env = GetEnvironmentVariableW(L"PATH", buff.data(), static_cast<DWORD>(buff.size()));
-	assert(got_env != 0);
-	assert(got_env < static_cast<DWORD>(buff.size()));
-	auto const buff_end = buff.begin() + got_env;
-	auto start = buff.begin();
-	for(;;)
-	{
-		auto const it = std::find(start, buff_end, L';');
-		tmp_path.assign(start, it).append(begin(dependency), end(dependency));
-		if(std::filesystem::exists(tmp_path))
-		{
-			self.m_result = tmp_path;
-			return true;
-		}
-		if(it == buff_end)
-		{
-			break;
-		}
-		start = it + 1;
-	}
-	return false;
-}
+#include "dependency_locator.h"
+
+#include "api_set.h"
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "scope_exit.h"
+#include "search_plan.h"
+#include "sxs_catalog.h"
+#include "sxs_manifest.h"
+#include "unicode.h"
+#include "utils.h"
+
+#include <algorithm>
+#include <array>
+
+#include "my_windows.h"
+
+
+static bool locate_dependency_in_dir(dependency_locator& self, wchar_t const* const dir, int const dir_len);
+static bool locate_dependency_sxs_private(dependency_locator& self, wchar_t const* const dir, int const dir_len, sxs_assembly_identity const& identity);
+
+
+bool locate_dependency(dependency_locator& self)
+{
+	assert(self.m_plan);
+	bool is_api_set;
+	bool const api_set_located = locate_dependency_api_set(self, &is_api_set);
+	if(is_api_set) return api_set_located;
+	if(locate_dependency_sxs(self)) return true;
+	if(locate_dependency_known_dlls(self)) return true;
+	if(locate_dependency_application_dir(self)) return true;
+	if(locate_dependency_system32(self)) return true;
+	if(locate_dependency_system16(self)) return true;
+	if(locate_dependency_windows(self)) return true;
+	if(locate_dependency_current_dir(self)) return true;
+	if(locate_dependency_environment_path(self)) return true;
+	return false;
+}
+
+
+bool locate_dependency_api_set(dependency_locator& self, bool* const is_api_set_out)
+{
+	assert(is_api_set_out);
+	api_set_schema const* const api_set = self.m_plan->m_api_set;
+	string host;
+	*is_api_set_out = api_set && api_set->resolve(*self.m_dependency->m_string, &host);
+	if(!*is_api_set_out || !host)
+	{
+		return false;
+	}
+	string_handle const* const dependency = self.m_dependency;
+	string_handle const host_handle{&host};
+	self.m_dependency = &host_handle;
+	auto const fn_restore_dependency = mk::make_scope_exit([&](){ self.m_dependency = dependency; });
+	return locate_dependency_known_dlls(self) || locate_dependency_system32(self);
+}
+
+bool locate_dependency_sxs(dependency_locator& self)
+{
+	search_plan_sxs_t const sxs = self.m_plan->m_sxs;
+	if(!sxs)
+	{
+		return false;
+	}
+	return sxs(self);
+}
+
+bool locate_dependency_known_dlls(dependency_locator& self)
+{
+	string_handle const& dependency = *self.m_dependency;
+	std::string& tmpn = self.m_tmpn;
+	self.m_tmpn.resize(size(dependency));
+	std::transform(begin(dependency), end(dependency), begin(tmpn), [](auto const& e){ return to_lowercase(e); });
+	auto const& known_dll_names = self.m_plan->m_known_dlls;
+	if(known_dll_names.find(tmpn) == known_dll_names.end())
+	{
+		return false;
+	}
+	self.m_result = std::filesystem::path{self.m_plan->m_known_dlls_path}.append(tmpn);
+	return true;
+}
+
+bool locate_dependency_application_dir(dependency_locator& self)
+{
+	wstring_handle const& main_path = self.m_main_path;
+	wchar_t const* const main_path_str = main_path.m_string->m_str;
+	int const main_dir_len = static_cast<int>(find_file_name(main_path_str, main_path.m_string->m_len) - main_path_str);
+	return locate_dependency_in_dir(self, main_path_str, main_dir_len);
+}
+
+bool locate_dependency_system32(dependency_locator& self)
+{
+	std::wstring const& dir = self.m_plan->m_system32;
+	return locate_dependency_in_dir(self, dir.c_str(), static_cast<int>(dir.size()));
+}
+
+bool locate_dependency_system16(dependency_locator&)
+{
+	// The 16-bit system directory. There is no function that obtains the path of this directory, but it is searched.
+	return false;
+}
+
+bool locate_dependency_windows(dependency_locator& self)
+{
+	std::wstring const& dir = self.m_plan->m_windows;
+	return locate_dependency_in_dir(self, dir.c_str(), static_cast<int>(dir.size()));
+}
+
+bool locate_dependency_current_dir(dependency_locator& self)
+{
+	std::wstring const& dir = self.m_plan->m_current_dir;
+	if(dir.empty())
+	{
+		return false;
+	}
+	return locate_dependency_in_dir(self, dir.c_str(), static_cast<int>(dir.size()));
+}
+
+bool locate_dependency_environment_path(dependency_locator& self)
+{
+	for(std::wstring const& dir : self.m_plan->m_path_dirs)
+	{
+		if(locate_dependency_in_dir(self, dir.c_str(), static_cast<int>(dir.size())))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+bool locate_dependency_sxs_native(dependency_locator& self)
+{
+	string_handle const& dependency = *self.m_dependency;
+	ACTCTX_SECTION_KEYED_DATA actctx_section_keyed_data{};
+	actctx_section_keyed_data.cbSize = sizeof(actctx_section_keyed_data);
+	BOOL const actctx_data_found = FindActCtxSectionStringA(0, nullptr, ACTIVATION_CONTEXT_SECTION_DLL_REDIRECTION, dependency.m_string->m_str, &actctx_section_keyed_data);
+	if(actctx_data_found == FALSE)
+	{
+		return false;
+	}
+	std::array<wchar_t, 1 * 1024> buff;
+	WARN_M_R(dependency.m_string->m_len < static_cast<int>(buff.size()), L"File name too long.", false);
+	std::transform(begin(dependency), end(dependency), buff.begin(), [](char const& ch) -> wchar_t { return static_cast<wchar_t>(ch); });
+	buff[size(dependency)] = L'\0';
+	self.m_result.resize(32 * 1024);
+	DWORD const found = SearchPathW(nullptr, buff.data(), nullptr, static_cast<int>(self.m_result.size()), self.m_result.data(), nullptr);
+	if(found == 0)
+	{
+		return false;
+	}
+	WARN_M_R(found < self.m_result.size(), L"Path too long.", false);
+	self.m_result.resize(found);
+	return true;
+}
+
+
+bool locate_dependency_sxs_offline(dependency_locator& self)
+{
+	for(std::wstring const& dir : self.m_sxs_dirs)
+	{
+		if(locate_dependency_in_dir(self, dir.c_str(), static_cast<int>(dir.size())))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void locate_dependency_sxs_prepare(dependency_locator& self, sxs_manifest const* const manifest, bool const is_32_bit)
+{
+	self.m_sxs_dirs.clear();
+	if(!manifest)
+	{
+		return;
+	}
+	sxs_catalog* const catalog = self.m_plan->m_sxs_catalog;
+	assert(catalog);
+	wstring_handle const& main_path = self.m_main_path;
+	wchar_t const* const main_path_str = main_path.m_string->m_str;
+	int const main_dir_len = static_cast<int>(find_file_name(main_path_str, main_path.m_string->m_len) - main_path_str);
+	for(sxs_assembly_identity const& identity : manifest->m_dependencies)
+	{
+		std::wstring const* const shared_dir = identity.m_token.empty() ? nullptr : catalog->resolve(identity, is_32_bit);
+		if(shared_dir)
+		{
+			self.m_sxs_dirs.push_back(*shared_dir);
+			continue;
+		}
+		locate_dependency_sxs_private(self, main_path_str, main_dir_len, identity);
+	}
+}
+
+
+bool locate_dependency_in_dir(dependency_locator& self, wchar_t const* const dir, int const dir_len)
+{
+	string_handle const& dependency = *self.m_dependency;
+	file_system const& fs = self.m_plan->m_fs;
+	if(!fs.m_file_exists(fs.m_param, dir, dir_len, *dependency.m_string))
+	{
+		return false;
+	}
+	std::filesystem::path& tmp_path = self.m_tmp_path;
+	tmp_path.assign(dir, dir + dir_len).append(begin(dependency), end(dependency));
+	self.m_result = tmp_path;
+	return true;
+}
+
+bool locate_dependency_sxs_private(dependency_locator& self, wchar_t const* const dir, int const dir_len, sxs_assembly_identity const& identity)
+{
+	file_system const& fs = self.m_plan->m_fs;
+	std::string& tmpn = self.m_tmpn;
+	tmpn.assign(identity.m_name).append(".manifest");
+	if(fs.m_file_exists(fs.m_param, dir, dir_len, string{tmpn.c_str(), static_cast<int>(tmpn.size())}))
+	{
+		self.m_sxs_dirs.emplace_back(dir, dir + dir_len);
+		return true;
+	}
+	std::filesystem::path& tmp_path = self.m_tmp_path;
+	tmp_path.assign(dir, dir + dir_len).append(identity.m_name);
+	std::wstring const sub_dir = tmp_path.wstring();
+	if(fs.m_file_exists(fs.m_param, sub_dir.c_str(), static_cast<int>(sub_dir.size()), string{tmpn.c_str(), static_cast<int>(tmpn.size())}))
+	{
+		self.m_sxs_dirs.push_back(sub_dir);
+		return true;
+	}
+	tmpn.assign(identity.m_name).append(".dll");
+	if(fs.m_file_exists(fs.m_param, sub_dir.c_str(), static_cast<int>(sub_dir.size()), string{tmpn.c_str(), static_cast<int>(tmpn.size())}))
+	{
+		self.m_sxs_dirs.push_back(sub_dir);
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,190 @@
+#include "directory_index.h"
+
+#include "cassert_my.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "my_windows.h"
+
+
+struct directory_index_entry
+{
+	std::uint64_t m_mtime;
+	std::uint32_t m_generation;
+	bool m_exists;
+	std::unordered_map<std::wstring, std::wstring> m_names;
+};
+
+struct directory_index_state
+{
+	std::shared_mutex m_mutex;
+	std::unordered_map<std::wstring, directory_index_entry> m_dirs;
+	std::uint32_t m_generation;
+};
+
+
+static directory_index_state* g_directory_index = nullptr;
+
+
+static bool directory_index_get_mtime(std::wstring const& dir, std::uint64_t* const mtime_out);
+static void directory_index_enumerate(std::wstring const& dir, directory_index_entry* const entry_out);
+static std::wstring directory_index_make_key(wchar_t const* const dir, int const dir_len);
+static bool directory_index_find(std::wstring const& key, std::wstring const& name, std::wstring* const real_name_out);
+
+
+void directory_index::init()
+{
+	if(g_directory_index)
+	{
+		return;
+	}
+	g_directory_index = new directory_index_state();
+	g_directory_index->m_generation = 0;
+}
+
+void directory_index::deinit()
+{
+	if(g_directory_index)
+	{
+		delete g_directory_index;
+		g_directory_index = nullptr;
+	}
+}
+
+void directory_index::begin_session()
+{
+	init();
+	assert(g_directory_index);
+	std::unique_lock<std::shared_mutex> const lck(g_directory_index->m_mutex);
+	++g_directory_index->m_generation;
+}
+
+bool directory_index::file_exists(wchar_t const* const dir, int const dir_len, string const& file_name)
+{
+	assert(g_directory_index);
+	bool const is_plain_name = std::none_of(begin(file_name), end(file_name), [](char const& ch){ return ch == '\\' || ch == '/'; });
+	if(dir_len == 0 || !is_plain_name || !is_ascii(file_name.m_str, file_name.m_len))
+	{
+		return std::filesystem::exists(std::filesystem::path{dir, dir + dir_len}.append(begin(file_name), end(file_name)));
+	}
+	std::wstring const key = directory_index_make_key(dir, dir_len);
+	std::wstring name(file_name.m_len, L'\0');
+	std::transform(begin(file_name), end(file_name), name.begin(), [](char const& ch){ return static_cast<wchar_t>(to_lowercase(ch)); });
+	return directory_index_find(key, name, nullptr);
+}
+
+bool directory_index::get_real_name(wchar_t const* const dir, int const dir_len, wchar_t const* const name, int const name_len, std::wstring* const real_name_out)
+{
+	assert(g_directory_index);
+	assert(real_name_out);
+	if(dir_len == 0 || name_len == 0)
+	{
+		return false;
+	}
+	std::wstring const key = directory_index_make_key(dir, dir_len);
+	std::wstring lowercase_name(name_len, L'\0');
+	std::transform(name, name + name_len, lowercase_name.begin(), [](wchar_t const& ch){ return to_lowercase(ch); });
+	return directory_index_find(key, lowercase_name, real_name_out);
+}
+
+
+bool directory_index_get_mtime(std::wstring const& dir, std::uint64_t* const mtime_out)
+{
+	assert(mtime_out);
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	BOOL const got = GetFileAttributesExW(dir.c_str(), GetFileExInfoStandard, &data);
+	if(got == 0 || (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+	{
+		*mtime_out = 0;
+		return false;
+	}
+	*mtime_out = (static_cast<std::uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | static_cast<std::uint64_t>(data.ftLastWriteTime.dwLowDateTime);
+	return true;
+}
+
+void directory_index_enumerate(std::wstring const& dir, directory_index_entry* const entry_out)
+{
+	assert(entry_out);
+	directory_index_entry& entry = *entry_out;
+	entry.m_names.clear();
+	entry.m_exists = directory_index_get_mtime(dir, &entry.m_mtime);
+	if(!entry.m_exists)
+	{
+		return;
+	}
+	std::wstring const pattern = dir + (dir.back() == L'\\' || dir.back() == L'/' ? L"*" : L"\\*");
+	WIN32_FIND_DATAW fd;
+	HANDLE const find = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+	if(find == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+	do
+	{
+		std::wstring real_name = fd.cFileName;
+		std::wstring name(real_name.size(), L'\0');
+		std::transform(real_name.begin(), real_name.end(), name.begin(), [](wchar_t const& ch){ return to_lowercase(ch); });
+		entry.m_names.emplace(std::move(name), std::move(real_name));
+	}
+	while(FindNextFileW(find, &fd) != 0);
+	BOOL const closed = FindClose(find);
+	assert(closed != 0);
+}
+
+std::wstring directory_index_make_key(wchar_t const* const dir, int const dir_len)
+{
+	assert(dir_len != 0);
+	bool const has_trailing_separator = dir[dir_len - 1] == L'\\' || dir[dir_len - 1] == L'/';
+	bool const is_drive_root = dir_len >= 2 && dir[dir_len - 2] == L':';
+	int const key_len = has_trailing_separator && !is_drive_root && dir_len != 1 ? dir_len - 1 : dir_len;
+	std::wstring key(key_len, L'\0');
+	std::transform(dir, dir + key_len, key.begin(), [](wchar_t const& ch){ return to_lowercase(ch); });
+	return key;
+}
+
+bool directory_index_find(std::wstring const& key, std::wstring const& name, std::wstring* const real_name_out)
+{
+	assert(g_directory_index);
+	directory_index_state& self = *g_directory_index;
+	static constexpr auto const lookup = [](directory_index_entry const& entry, std::wstring const& name, std::wstring* const real_name_out)
+	{
+		auto const it = entry.m_names.find(name);
+		if(it == entry.m_names.end())
+		{
+			return false;
+		}
+		if(real_name_out)
+		{
+			*real_name_out = it->second;
+		}
+		return true;
+	};
+	{
+		std::shared_lock<std::shared_mutex> const lck(self.m_mutex);
+		auto const it = self.m_dirs.find(key);
+		if(it != self.m_dirs.end() && it->second.m_generation == self.m_generation)
+		{
+			return lookup(it->second, name, real_name_out);
+		}
+	}
+	std::unique_lock<std::shared_mutex> const lck(self.m_mutex);
+	directory_index_entry& entry = self.m_dirs[key];
+	if(entry.m_generation != self.m_generation)
+	{
+		std::uint64_t mtime;
+		bool const exists = directory_index_get_mtime(key, &mtime);
+		if(exists != entry.m_exists || (exists && mtime != entry.m_mtime) || entry.m_generation == 0)
+		{
+			directory_index_enumerate(key, &entry);
+		}
+		entry.m_generation = self.m_generation;
+	}
+	return lookup(entry, name, real_name_out);
+}
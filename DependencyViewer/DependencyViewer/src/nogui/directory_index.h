@@ -0,0 +1,16 @@
+#pragma once
+
+
+#include "my_string.h"
+
+#include <string>
+
+
+namespace directory_index
+{
+	void init();
+	void deinit();
+	void begin_session();
+	bool file_exists(wchar_t const* const dir, int const dir_len, string const& file_name);
+	bool get_real_name(wchar_t const* const dir, int const dir_len, wchar_t const* const name, int const name_len, std::wstring* const real_name_out);
+}
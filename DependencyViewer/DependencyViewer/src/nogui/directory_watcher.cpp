@@ -0,0 +1,151 @@
+#include "directory_watcher.h"
+
+#include "cassert_my.h"
+
+#include <array>
+#include <limits>
+
+#include "my_windows.h"
+
+
+static constexpr DWORD const s_directory_watcher_debounce_ms = 500;
+static constexpr ULONG_PTR const s_directory_watcher_stop_key = std::numeric_limits<ULONG_PTR>::max();
+static constexpr DWORD const s_directory_watcher_filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+
+
+struct directory_watcher_entry
+{
+	smart_handle m_dir;
+	OVERLAPPED m_overlapped;
+	std::array<DWORD, 4 * 1024> m_buffer;
+	bool m_pending;
+};
+
+
+static bool directory_watcher_issue(directory_watcher_entry& entry);
+
+
+directory_watcher::directory_watcher() :
+	m_thread(),
+	m_port(),
+	m_entries(),
+	m_callback(),
+	m_param()
+{
+}
+
+directory_watcher::~directory_watcher()
+{
+	stop();
+}
+
+void directory_watcher::watch(std::vector<std::wstring> const& dirs, directory_watcher_callback_t const callback, directory_watcher_param_t const param)
+{
+	assert(callback);
+	stop();
+	m_port.reset(CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1));
+	if(!m_port)
+	{
+		return;
+	}
+	m_callback = callback;
+	m_param = param;
+	for(std::wstring const& dir : dirs)
+	{
+		HANDLE const dir_handle = CreateFileW(dir.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if(dir_handle == INVALID_HANDLE_VALUE)
+		{
+			continue;
+		}
+		auto entry = std::make_unique<directory_watcher_entry>();
+		entry->m_dir.reset(dir_handle);
+		entry->m_pending = false;
+		ULONG_PTR const key = static_cast<ULONG_PTR>(m_entries.size());
+		HANDLE const associated = CreateIoCompletionPort(dir_handle, m_port.get(), key, 0);
+		if(associated == nullptr || !directory_watcher_issue(*entry))
+		{
+			continue;
+		}
+		m_entries.push_back(std::move(entry));
+	}
+	directory_watcher* const self = this;
+	m_thread = std::thread([self](){ self->thread_func(); });
+}
+
+void directory_watcher::stop()
+{
+	if(!m_port)
+	{
+		return;
+	}
+	if(m_thread.joinable())
+	{
+		BOOL const posted = PostQueuedCompletionStatus(m_port.get(), 0, s_directory_watcher_stop_key, nullptr);
+		assert(posted != 0);
+		m_thread.join();
+	}
+	for(auto const& entry : m_entries)
+	{
+		if(entry->m_pending)
+		{
+			[[maybe_unused]] BOOL const cancelled = CancelIoEx(entry->m_dir.get(), &entry->m_overlapped);
+		}
+	}
+	for(auto const& entry : m_entries)
+	{
+		if(entry->m_pending)
+		{
+			DWORD bytes;
+			[[maybe_unused]] BOOL const got = GetOverlappedResult(entry->m_dir.get(), &entry->m_overlapped, &bytes, TRUE);
+			entry->m_pending = false;
+		}
+	}
+	m_entries.clear();
+	m_port.reset();
+	m_callback = nullptr;
+	m_param = nullptr;
+}
+
+void directory_watcher::thread_func()
+{
+	bool dirty = false;
+	for(;;)
+	{
+		DWORD bytes;
+		ULONG_PTR key;
+		OVERLAPPED* overlapped;
+		BOOL const got = GetQueuedCompletionStatus(m_port.get(), &bytes, &key, &overlapped, dirty ? s_directory_watcher_debounce_ms : INFINITE);
+		if(got == 0 && overlapped == nullptr)
+		{
+			if(GetLastError() != WAIT_TIMEOUT)
+			{
+				break;
+			}
+			dirty = false;
+			m_callback(m_param);
+			continue;
+		}
+		if(key == s_directory_watcher_stop_key)
+		{
+			break;
+		}
+		assert(key < m_entries.size());
+		directory_watcher_entry& entry = *m_entries[key];
+		entry.m_pending = false;
+		if(got == 0)
+		{
+			continue;
+		}
+		dirty = true;
+		directory_watcher_issue(entry);
+	}
+}
+
+
+bool directory_watcher_issue(directory_watcher_entry& entry)
+{
+	entry.m_overlapped = OVERLAPPED{};
+	BOOL const issued = ReadDirectoryChangesW(entry.m_dir.get(), entry.m_buffer.data(), static_cast<DWORD>(entry.m_buffer.size() * sizeof(DWORD)), FALSE, s_directory_watcher_filter, nullptr, &entry.m_overlapped, nullptr);
+	entry.m_pending = issued != 0;
+	return entry.m_pending;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+
+#include "smart_handle.h"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+typedef void* directory_watcher_param_t;
+typedef void(*directory_watcher_callback_t)(directory_watcher_param_t const param);
+
+
+struct directory_watcher_entry;
+
+
+class directory_watcher
+{
+public:
+	directory_watcher();
+	directory_watcher(directory_watcher const&) = delete;
+	directory_watcher& operator=(directory_watcher const&) = delete;
+	~directory_watcher();
+public:
+	void watch(std::vector<std::wstring> const& dirs, directory_watcher_callback_t const callback, directory_watcher_param_t const param);
+	void stop();
+private:
+	void thread_func();
+private:
+	std::thread m_thread;
+	smart_handle m_port;
+	std::vector<std::unique_ptr<directory_watcher_entry>> m_entries;
+	directory_watcher_callback_t m_callback;
+	directory_watcher_param_t m_param;
+};
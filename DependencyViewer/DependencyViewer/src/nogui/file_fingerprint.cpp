@@ -0,0 +1,29 @@
+#include "file_fingerprint.h"
+
+#include "cassert_my.h"
+
+#include "my_windows.h"
+
+
+bool get_file_fingerprint(wchar_t const* const file_name, file_fingerprint* const fingerprint_out)
+{
+	assert(file_name);
+	assert(fingerprint_out);
+	file_fingerprint& fingerprint = *fingerprint_out;
+	fingerprint.m_size = 0;
+	fingerprint.m_mtime = 0;
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	BOOL const got = GetFileAttributesExW(file_name, GetFileExInfoStandard, &data);
+	if(got == 0 || (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+	{
+		return false;
+	}
+	fingerprint.m_size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) | static_cast<std::uint64_t>(data.nFileSizeLow);
+	fingerprint.m_mtime = (static_cast<std::uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | static_cast<std::uint64_t>(data.ftLastWriteTime.dwLowDateTime);
+	return true;
+}
+
+bool file_fingerprint_equal(file_fingerprint const& a, file_fingerprint const& b)
+{
+	return a.m_mtime != 0 && a.m_size == b.m_size && a.m_mtime == b.m_mtime;
+}
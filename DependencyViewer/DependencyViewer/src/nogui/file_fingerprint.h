@@ -0,0 +1,15 @@
+#pragma once
+
+
+#include <cstdint>
+
+
+struct file_fingerprint
+{
+	std::uint64_t m_size;
+	std::uint64_t m_mtime;
+};
+
+
+bool get_file_fingerprint(wchar_t const* const file_name, file_fingerprint* const fingerprint_out);
+bool file_fingerprint_equal(file_fingerprint const& a, file_fingerprint const& b);
@@ -1,89 +1,45 @@
-#include "file_name_provider.h"
-
-#include "assert_my.h"
-#include "cassert_my.h"
-#include "scope_exit.h"
-
-#include <utility>
-
-
-static file_name_provider* g_file_name_provider = nullptr;
-
-
-void file_name_provider::init()
-{
-	assert(!g_file_name_provider);
-	g_file_name_provider = new file_name_provider();
-}
-
-void file_name_provider::deinit()
-{
-	assert(g_file_name_provider);
-	delete g_file_name_provider;
-	g_file_name_provider = nullptr;
-}
-
-wstring_handle file_name_provider::get_correct_file_name(wchar_t const* const& file_name, int const& file_name_len, wunique_strings& us, allocator& alc)
-{
-	assert(g_file_name_provider);
-	if(!g_file_name_provider->ok())
-	{
-		return {};
-	}
-	return g_file_name_provider->get_correct_file_name_(file_name, file_name_len, us, alc);
-}
-
-file_name_provider::file_name_provider() :
-	m_clsid(),
-	m_object(),
-	m_method()
-{
-	CLSID clsid;
-	HRESULT const get_clsid = CLSIDFromProgID(L"Scripting.FileSystemObject", &clsid);
-	WARN_M_RV(get_clsid == S_OK, L"Failed to CLSIDFromProgID.");
-	IDispatch* object = nullptr;
-	HRESULT const instance_created = CoCreateInstance(clsid, nullptr, CLSCTX_INPROC_SERVER, IID_IDispatch, reinterpret_cast<void**>(&object));
-	WARN_M_RV(instance_created == S_OK && object != nullptr, L"Failed to CoCreateInstance.");
-	com_ptr<IDispatch> object_sp(object);
-	static constexpr wchar_t const s_method_name[] = L"GetAbsolutePathName";
-	wchar_t const* const method_name = s_method_name;
-	DISPID method;
-	HRESULT const got_method = object->lpVtbl->GetIDsOfNames(object, IID_NULL, const_cast<wchar_t**>(&method_name), 1, LOCALE_USER_DEFAULT, &method);
-	WARN_M_RV(got_method == S_OK, L"Failed to IDispatch::GetIDsOfNames.");
-	m_clsid = clsid;
-	m_object = std::move(object_sp);
-	m_method = method;
-}
-
-file_name_provider::~file_name_provider()
-{
-}
-
-bool file_name_provider::ok() const
-{
-	return m_object != nullptr;
-}
-
-wstring_handle file_name_provider::get_correct_file_name_(wchar_t const* const& file_name, int const& file_name_len, wunique_strings& us, allocator& alc)
-{
-	VARIANT arg_1;
-	arg_1.vt = VT_BSTR;
-	arg_1.bstrVal = SysAllocStringLen(file_name, file_name_len);
-	auto const free_sys_string_1 = mk::make_scope_exit([&](){ SysFreeString(arg_1.bstrVal); });
-	DISPPARAMS input;
-	input.rgvarg = &arg_1;
-	input.rgdispidNamedArgs = nullptr;
-	input.cArgs = 1;
-	input.cNamedArgs = 0;
-	VARIANT output;
-	output.vt = VT_BSTR;
-	output.bstrVal = nullptr;
-	HRESULT const invoked = m_object->lpVtbl->Invoke(m_object, m_method, m_clsid, LOCALE_USER_DEFAULT, DISPATCH_METHOD, &input, &output, nullptr, nullptr);
-	WARN_M_R(invoked == S_OK, L"Failed to IDispatch::Invoke.", {});
-	WARN_M_R(output.bstrVal, L"Failed to IDispatch::Invoke.", {});
-	auto const free_sys_string_2 = mk::make_scope_exit([&](){ SysFreeString(output.bstrVal); });
-	int const output_len = static_cast<int>(*reinterpret_cast<std::uint32_t const*>(reinterpret_cast<char const*>(output.bstrVal) - sizeof(std::uint32_t)));
-	assert(output_len % 2 == 0);
-	wstring_handle const ret = us.add_string(output.bstrVal, output_len / 2, alc);
-	return ret;
-}
+#include "file_name_provider.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "directory_index.h"
+#include "path_canonicalizer.h"
+
+#include "my_windows.h"
+
+
+static bool file_name_provider_real_name(path_canonicalizer_param_t const param, wchar_t const* const dir, int const dir_len, wchar_t const* const name, int const name_len, std::wstring* const real_name_out);
+
+
+bool file_name_provider::get_correct_file_name(wchar_t const* const& file_name, int const& file_name_len, std::wstring* const out)
+{
+	assert(out);
+	DWORD const currdir_len = GetCurrentDirectoryW(0, nullptr);
+	WARN_M_R(currdir_len != 0, L"Failed to GetCurrentDirectoryW.", false);
+	std::wstring current_dir(currdir_len, L'\0');
+	DWORD const got_currdir = GetCurrentDirectoryW(currdir_len, current_dir.data());
+	WARN_M_R(got_currdir != 0 && got_currdir < currdir_len, L"Failed to GetCurrentDirectoryW.", false);
+	path_canonicalizer pc;
+	pc.m_current_dir = current_dir.c_str();
+	pc.m_current_dir_len = static_cast<int>(got_currdir);
+	pc.m_real_name = &file_name_provider_real_name;
+	pc.m_param = nullptr;
+	bool const canonicalized = canonicalize_path(pc, file_name, file_name_len, out);
+	WARN_M_R(canonicalized, L"Failed to canonicalize_path.", false);
+	return true;
+}
+
+wstring_handle file_name_provider::get_correct_file_name(wchar_t const* const& file_name, int const& file_name_len, wunique_strings& us, allocator& alc)
+{
+	std::wstring correct_file_name;
+	bool const got = get_correct_file_name(file_name, file_name_len, &correct_file_name);
+	WARN_M_R(got, L"Failed to get_correct_file_name.", {});
+	wstring_handle const ret = us.add_string(correct_file_name.c_str(), static_cast<int>(correct_file_name.size()), alc);
+	return ret;
+}
+
+
+bool file_name_provider_real_name([[maybe_unused]] path_canonicalizer_param_t const param, wchar_t const* const dir, int const dir_len, wchar_t const* const name, int const name_len, std::wstring* const real_name_out)
+{
+	return directory_index::get_real_name(dir, dir_len, name, name_len, real_name_out);
+}
@@ -0,0 +1,193 @@
+#include "file_prefetcher.h"
+
+#include "cassert_my.h"
+#include "pe/coff_full.h"
+#include "pe/mz.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+
+static constexpr int const s_file_prefetcher_window = 8;
+static constexpr int const s_file_prefetcher_page_size = 4 * 1024;
+static constexpr pe_e_directory_table const s_file_prefetcher_directories[] =
+{
+	pe_e_directory_table::export_table,
+	pe_e_directory_table::import_table,
+	pe_e_directory_table::resource_table,
+	pe_e_directory_table::debug,
+	pe_e_directory_table::delay_import_descriptor,
+};
+
+
+enum class e_file_prefetcher_state : std::uint8_t
+{
+	e_pending,
+	e_in_flight,
+	e_ready,
+	e_taken,
+};
+
+
+static void file_prefetcher_touch_pages(memory_mapped_file const& mmf);
+static void file_prefetcher_touch_range(std::byte const* const data, std::uint32_t const begin, std::uint32_t const size);
+
+
+file_prefetcher::file_prefetcher() :
+	m_thread(),
+	m_mutex(),
+	m_work_condition_variable(),
+	m_done_condition_variable(),
+	m_file_names(),
+	m_files(),
+	m_states(),
+	m_next(0),
+	m_in_flight(0),
+	m_thread_stop_requested(false)
+{
+	file_prefetcher* const self = this;
+	m_thread = std::thread([self](){ self->thread_func(); });
+}
+
+file_prefetcher::~file_prefetcher()
+{
+	{
+		std::lock_guard<std::mutex> lck(m_mutex);
+		m_thread_stop_requested = true;
+	}
+	m_work_condition_variable.notify_one();
+	m_thread.join();
+}
+
+void file_prefetcher::start(std::vector<wchar_t const*> const& file_names)
+{
+	{
+		std::lock_guard<std::mutex> lck(m_mutex);
+		assert(m_in_flight == 0);
+		int const n = static_cast<int>(file_names.size());
+		m_file_names = file_names;
+		m_files.clear();
+		m_files.resize(n);
+		m_states.resize(n);
+		std::transform(file_names.begin(), file_names.end(), m_states.begin(), [](wchar_t const* const& file_name){ return static_cast<std::uint8_t>(file_name ? e_file_prefetcher_state::e_pending : e_file_prefetcher_state::e_taken); });
+		m_next = 0;
+	}
+	m_work_condition_variable.notify_one();
+}
+
+memory_mapped_file file_prefetcher::get(int const idx)
+{
+	std::unique_lock<std::mutex> lck(m_mutex);
+	assert(idx >= 0 && idx < static_cast<int>(m_states.size()));
+	e_file_prefetcher_state const state = static_cast<e_file_prefetcher_state>(m_states[idx]);
+	assert(state != e_file_prefetcher_state::e_taken);
+	if(state == e_file_prefetcher_state::e_pending)
+	{
+		m_states[idx] = static_cast<std::uint8_t>(e_file_prefetcher_state::e_taken);
+		wchar_t const* const file_name = m_file_names[idx];
+		lck.unlock();
+		return memory_mapped_file(file_name);
+	}
+	file_prefetcher* const self = this;
+	m_done_condition_variable.wait(lck, [self, idx](){ return self->m_states[idx] == static_cast<std::uint8_t>(e_file_prefetcher_state::e_ready); });
+	m_states[idx] = static_cast<std::uint8_t>(e_file_prefetcher_state::e_taken);
+	memory_mapped_file ret = std::move(m_files[idx]);
+	--m_in_flight;
+	lck.unlock();
+	m_work_condition_variable.notify_one();
+	return ret;
+}
+
+void file_prefetcher::thread_func()
+{
+	file_prefetcher* const self = this;
+	auto const has_work = [self]()
+	{
+		while(self->m_next != static_cast<int>(self->m_states.size()) && self->m_states[self->m_next] != static_cast<std::uint8_t>(e_file_prefetcher_state::e_pending))
+		{
+			++self->m_next;
+		}
+		return self->m_next != static_cast<int>(self->m_states.size()) && self->m_in_flight < s_file_prefetcher_window;
+	};
+	for(;;)
+	{
+		int idx;
+		wchar_t const* file_name;
+		{
+			std::unique_lock<std::mutex> lck(m_mutex);
+			m_work_condition_variable.wait(lck, [&](){ return m_thread_stop_requested || has_work(); });
+			if(m_thread_stop_requested)
+			{
+				break;
+			}
+			idx = m_next;
+			file_name = m_file_names[idx];
+			m_states[idx] = static_cast<std::uint8_t>(e_file_prefetcher_state::e_in_flight);
+			++m_in_flight;
+			++m_next;
+		}
+		memory_mapped_file mmf(file_name);
+		file_prefetcher_touch_pages(mmf);
+		{
+			std::lock_guard<std::mutex> lck(m_mutex);
+			m_files[idx] = std::move(mmf);
+			m_states[idx] = static_cast<std::uint8_t>(e_file_prefetcher_state::e_ready);
+		}
+		m_done_condition_variable.notify_all();
+	}
+}
+
+
+void file_prefetcher_touch_pages(memory_mapped_file const& mmf)
+{
+	// Only the headers and the directories the parsers read, the rest of the image is never looked at.
+	std::byte const* const data = mmf.begin();
+	if(!data)
+	{
+		return;
+	}
+	int const size = mmf.size();
+	pe_dos_header const* dos_hdr;
+	pe_coff_full_32_64 const* coff_hdr;
+	if(pe_parse_mz_header(data, size, &dos_hdr) != pe_e_parse_mz_header::ok || !pe_parse_coff_full_32_64(data, size, &coff_hdr))
+	{
+		return;
+	}
+	bool const is_32 = pe_is_32_bit(coff_hdr->m_32.m_standard);
+	std::uint32_t const headers_size = is_32 ? coff_hdr->m_32.m_windows.m_headers_size : coff_hdr->m_64.m_windows.m_headers_size;
+	file_prefetcher_touch_range(data, 0, (std::min)(headers_size, static_cast<std::uint32_t>(size)));
+	std::uint32_t const dir_cnt = is_32 ? coff_hdr->m_32.m_windows.m_data_directory_count : coff_hdr->m_64.m_windows.m_data_directory_count;
+	std::uint16_t const sect_cnt = is_32 ? coff_hdr->m_32.m_coff.m_section_count : coff_hdr->m_64.m_coff.m_section_count;
+	pe_data_directory const* const dirs = reinterpret_cast<pe_data_directory const*>(data + dos_hdr->m_pe_offset + (is_32 ? sizeof(pe_coff_full_32) : sizeof(pe_coff_full_64)));
+	pe_section_header const* const sects = reinterpret_cast<pe_section_header const*>(dirs + dir_cnt);
+	for(pe_e_directory_table const& dir_idx : s_file_prefetcher_directories)
+	{
+		if(!(static_cast<std::uint32_t>(dir_idx) < dir_cnt))
+		{
+			continue;
+		}
+		pe_data_directory const& dir = dirs[static_cast<int>(dir_idx)];
+		if(dir.m_va == 0 || dir.m_size == 0)
+		{
+			continue;
+		}
+		auto const it = std::find_if(sects, sects + sect_cnt, [&](pe_section_header const& sect){ return dir.m_va >= sect.m_virtual_address && dir.m_va - sect.m_virtual_address < sect.m_raw_size; });
+		if(it == sects + sect_cnt)
+		{
+			continue;
+		}
+		std::uint32_t const offset = dir.m_va - it->m_virtual_address;
+		file_prefetcher_touch_range(data, it->m_raw_ptr + offset, (std::min)(dir.m_size, it->m_raw_size - offset));
+	}
+}
+
+void file_prefetcher_touch_range(std::byte const* const data, std::uint32_t const begin, std::uint32_t const size)
+{
+	std::byte const volatile* const bytes = data;
+	std::uint32_t const end = begin + size;
+	for(std::uint32_t i = begin &~ (s_file_prefetcher_page_size - 1); i < end; i += s_file_prefetcher_page_size)
+	{
+		static_cast<void>(bytes[i]);
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+
+#include "memory_mapped_file.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+class file_prefetcher
+{
+public:
+	file_prefetcher();
+	file_prefetcher(file_prefetcher const&) = delete;
+	file_prefetcher& operator=(file_prefetcher const&) = delete;
+	~file_prefetcher();
+public:
+	void start(std::vector<wchar_t const*> const& file_names);
+	memory_mapped_file get(int const idx);
+private:
+	void thread_func();
+private:
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_work_condition_variable;
+	std::condition_variable m_done_condition_variable;
+	std::vector<wchar_t const*> m_file_names;
+	std::vector<memory_mapped_file> m_files;
+	std::vector<std::uint8_t> m_states;
+	int m_next;
+	int m_in_flight;
+	bool m_thread_stop_requested;
+};
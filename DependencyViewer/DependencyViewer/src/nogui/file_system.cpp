@@ -0,0 +1,21 @@
+#include "file_system.h"
+
+#include "directory_index.h"
+
+
+static bool native_file_system_file_exists(file_system_param_t const param, wchar_t const* const dir, int const dir_len, string const& file_name);
+
+
+file_system get_native_file_system()
+{
+	file_system ret;
+	ret.m_file_exists = &native_file_system_file_exists;
+	ret.m_param = nullptr;
+	return ret;
+}
+
+
+bool native_file_system_file_exists([[maybe_unused]] file_system_param_t const param, wchar_t const* const dir, int const dir_len, string const& file_name)
+{
+	return directory_index::file_exists(dir, dir_len, file_name);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+
+#include "my_string.h"
+
+
+typedef void* file_system_param_t;
+typedef bool(*file_system_file_exists_t)(file_system_param_t const param, wchar_t const* const dir, int const dir_len, string const& file_name);
+
+
+struct file_system
+{
+	file_system_file_exists_t m_file_exists;
+	file_system_param_t m_param;
+};
+
+
+file_system get_native_file_system();
@@ -0,0 +1,91 @@
+#include "memory_file_system.h"
+
+#include "cassert_my.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <utility>
+
+
+static std::wstring memory_file_system_make_dir_key(wchar_t const* const dir, int const dir_len);
+static std::string memory_file_system_make_name_key(string const& file_name);
+static bool memory_file_system_file_exists(file_system_param_t const param, wchar_t const* const dir, int const dir_len, string const& file_name);
+
+
+memory_file_system::memory_file_system() :
+	m_dirs()
+{
+}
+
+memory_file_system::memory_file_system(memory_file_system&& other) noexcept :
+	memory_file_system()
+{
+	swap(other);
+}
+
+memory_file_system& memory_file_system::operator=(memory_file_system&& other) noexcept
+{
+	swap(other);
+	return *this;
+}
+
+memory_file_system::~memory_file_system()
+{
+}
+
+void memory_file_system::swap(memory_file_system& other) noexcept
+{
+	using std::swap;
+	swap(m_dirs, other.m_dirs);
+}
+
+void memory_file_system::add_file(wchar_t const* const dir, int const dir_len, string const& file_name)
+{
+	m_dirs[memory_file_system_make_dir_key(dir, dir_len)].insert(memory_file_system_make_name_key(file_name));
+}
+
+bool memory_file_system::file_exists(wchar_t const* const dir, int const dir_len, string const& file_name) const
+{
+	auto const it = m_dirs.find(memory_file_system_make_dir_key(dir, dir_len));
+	if(it == m_dirs.end())
+	{
+		return false;
+	}
+	return it->second.find(memory_file_system_make_name_key(file_name)) != it->second.end();
+}
+
+file_system memory_file_system::get_file_system() const
+{
+	file_system ret;
+	ret.m_file_exists = &memory_file_system_file_exists;
+	ret.m_param = const_cast<memory_file_system*>(this);
+	return ret;
+}
+
+
+std::wstring memory_file_system_make_dir_key(wchar_t const* const dir, int const dir_len)
+{
+	assert(dir_len >= 0);
+	int key_len = dir_len;
+	while(key_len != 0 && (dir[key_len - 1] == L'\\' || dir[key_len - 1] == L'/'))
+	{
+		--key_len;
+	}
+	std::wstring key(key_len, L'\0');
+	std::transform(dir, dir + key_len, key.begin(), [](wchar_t const& ch){ return ch == L'/' ? L'\\' : to_lowercase(ch); });
+	return key;
+}
+
+std::string memory_file_system_make_name_key(string const& file_name)
+{
+	std::string key(file_name.m_len, '\0');
+	std::transform(begin(file_name), end(file_name), key.begin(), [](char const& ch){ return to_lowercase(ch); });
+	return key;
+}
+
+bool memory_file_system_file_exists(file_system_param_t const param, wchar_t const* const dir, int const dir_len, string const& file_name)
+{
+	assert(param);
+	memory_file_system const& self = *static_cast<memory_file_system const*>(param);
+	return self.file_exists(dir, dir_len, file_name);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+
+#include "file_system.h"
+#include "my_string.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+
+class memory_file_system
+{
+public:
+	memory_file_system();
+	memory_file_system(memory_file_system const&) = delete;
+	memory_file_system(memory_file_system&& other) noexcept;
+	memory_file_system& operator=(memory_file_system const&) = delete;
+	memory_file_system& operator=(memory_file_system&& other) noexcept;
+	~memory_file_system();
+	void swap(memory_file_system& other) noexcept;
+public:
+	void add_file(wchar_t const* const dir, int const dir_len, string const& file_name);
+	bool file_exists(wchar_t const* const dir, int const dir_len, string const& file_name) const;
+	file_system get_file_system() const;
+private:
+	std::unordered_map<std::wstring, std::unordered_set<std::string>> m_dirs;
+};
+
+inline void swap(memory_file_system& a, memory_file_system& b) noexcept { a.swap(b); }
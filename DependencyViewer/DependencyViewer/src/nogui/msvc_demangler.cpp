@@ -0,0 +1,1058 @@
+#include "msvc_demangler.h"
+
+#include "allocator.h"
+#include "cassert_my.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+
+struct msvc_demangler_buffer
+{
+	char* m_data;
+	int m_len;
+	int m_cap;
+};
+
+struct msvc_demangler_backrefs
+{
+	string m_names[10];
+	int m_names_count;
+	string m_types[10];
+	int m_types_count;
+};
+
+struct msvc_demangler_state
+{
+	char const* m_cur;
+	char const* m_end;
+	allocator* m_alc;
+	msvc_demangler_backrefs* m_refs;
+	int m_depth;
+};
+
+enum class msvc_demangler_special
+{
+	e_none,
+	e_ctor,
+	e_dtor,
+	e_conversion,
+};
+
+
+static constexpr int const s_msvc_demangler_max_depth = 64;
+static constexpr int const s_msvc_demangler_max_components = 32;
+
+static constexpr char const* const s_msvc_demangler_operators[] =
+{
+	/* 0 */ nullptr, /* 1 */ nullptr, "operator new", "operator delete", "operator=", "operator>>", "operator<<", "operator!", "operator==", "operator!=",
+	/* A */ "operator[]", /* B */ nullptr, "operator->", "operator*", "operator++", "operator--", "operator-", "operator+", "operator&", "operator->*",
+	/* K */ "operator/", "operator%", "operator<", "operator<=", "operator>", "operator>=", "operator,", "operator()", "operator~", "operator^",
+	/* U */ "operator|", "operator&&", "operator||", "operator*=", "operator+=", "operator-=",
+};
+static constexpr char const* const s_msvc_demangler_operators_ex[] =
+{
+	/* _0 */ "operator/=", "operator%=", "operator>>=", "operator<<=", "operator&=", "operator|=", "operator^=", "`vftable'", "`vbtable'", "`vcall'",
+	/* _A */ "`typeof'", "`local static guard'", /* _C */ nullptr, "`vbase destructor'", "`vector deleting destructor'", "`default constructor closure'", "`scalar deleting destructor'", "`vector constructor iterator'", "`vector destructor iterator'", "`vector vbase constructor iterator'",
+	/* _K */ "`virtual displacement map'", "`eh vector constructor iterator'", "`eh vector destructor iterator'", "`eh vector vbase constructor iterator'", "`copy constructor closure'", /* _P */ nullptr, /* _Q */ nullptr, /* _R */ nullptr, "`local vftable'", "`local vftable constructor closure'",
+	/* _U */ "operator new[]", "operator delete[]", /* _W */ nullptr, "`placement delete closure'", "`placement delete[] closure'",
+};
+static constexpr char const* const s_msvc_demangler_rtti[] =
+{
+	/* _R0 */ nullptr, /* _R1 */ nullptr, "`RTTI Base Class Array'", "`RTTI Class Hierarchy Descriptor'", "`RTTI Complete Object Locator'",
+};
+static constexpr char const* const s_msvc_demangler_primitives[] =
+{
+	/* A */ nullptr, nullptr, "signed char", "char", "unsigned char", "short", "unsigned short", "int", "unsigned int", "long",
+	/* K */ "unsigned long", nullptr, "float", "double", "long double", nullptr, nullptr, nullptr, nullptr, nullptr,
+	/* U */ nullptr, nullptr, nullptr, "void",
+};
+static constexpr char const* const s_msvc_demangler_primitives_ex[] =
+{
+	/* _A */ nullptr, nullptr, nullptr, "__int8", "unsigned __int8", "__int16", "unsigned __int16", "__int32", "unsigned __int32", "__int64",
+	/* _K */ "unsigned __int64", "__int128", "unsigned __int128", "bool", nullptr, nullptr, "char8_t", nullptr, "char16_t", nullptr,
+	/* _U */ "char32_t", nullptr, "wchar_t",
+};
+static constexpr char const* const s_msvc_demangler_calling_conventions[] =
+{
+	"__cdecl", "__pascal", "__thiscall", "__stdcall", "__fastcall", nullptr, "__clrcall", "__eabi", "__vectorcall",
+};
+static constexpr char const* const s_msvc_demangler_cvs[] =
+{
+	"", " const", " volatile", " const volatile",
+};
+static constexpr char const* const s_msvc_demangler_accesses[] =
+{
+	"private: ", "protected: ", "public: ",
+};
+static constexpr char const* const s_msvc_demangler_data_accesses[] =
+{
+	"private: static ", "protected: static ", "public: static ", "", "",
+};
+
+
+static void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, char const* const str, int const len);
+static void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, char const* const str);
+static void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, string const& str);
+static void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, msvc_demangler_buffer const& str);
+static void msvc_demangler_append_number(msvc_demangler_state& st, msvc_demangler_buffer& buf, std::int64_t const number);
+static string msvc_demangler_to_string(msvc_demangler_buffer const& buf);
+static bool msvc_demangler_consume(msvc_demangler_state& st, char const ch);
+static bool msvc_demangler_consume(msvc_demangler_state& st, char const* const prefix);
+static bool msvc_demangler_cv(msvc_demangler_state& st, int* const cv_out);
+static bool msvc_demangler_number(msvc_demangler_state& st, std::int64_t* const number_out);
+static void msvc_demangler_memorize_name(msvc_demangler_state& st, string const& name);
+static bool msvc_demangler_symbol(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_qualified_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out);
+static bool msvc_demangler_leaf_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out);
+static bool msvc_demangler_operator_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out);
+static bool msvc_demangler_scope_name(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_simple_name(msvc_demangler_state& st, bool const memorize, string* const name_out);
+static bool msvc_demangler_back_ref_name(msvc_demangler_state& st, string* const name_out);
+static bool msvc_demangler_template_name(msvc_demangler_state& st, bool const memorize, msvc_demangler_buffer& out);
+static bool msvc_demangler_template_arg(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_variable(msvc_demangler_state& st, char const code, msvc_demangler_buffer const& name, msvc_demangler_buffer& out);
+static bool msvc_demangler_table(msvc_demangler_state& st, msvc_demangler_buffer const& name, msvc_demangler_buffer& out);
+static bool msvc_demangler_function(msvc_demangler_state& st, char const code, msvc_demangler_buffer const& name, msvc_demangler_special const special, msvc_demangler_buffer& out);
+static bool msvc_demangler_calling_convention(msvc_demangler_state& st, char const** const calling_convention_out);
+static bool msvc_demangler_return_type(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_args(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_throw_spec(msvc_demangler_state& st);
+static bool msvc_demangler_type(msvc_demangler_state& st, msvc_demangler_buffer& out);
+static bool msvc_demangler_pointer(msvc_demangler_state& st, char const* const declarator, int const pointer_cv, msvc_demangler_buffer& out);
+
+
+bool msvc_demangle(char const* const decorated, int const len, allocator& alc, string* const undecorated_out)
+{
+	assert(decorated);
+	assert(undecorated_out);
+	msvc_demangler_backrefs refs{};
+	msvc_demangler_state st{decorated, decorated + len, &alc, &refs, 0};
+	msvc_demangler_buffer out{};
+	bool const demangled = msvc_demangler_symbol(st, out);
+	if(!demangled || st.m_cur != st.m_end)
+	{
+		return false;
+	}
+	*undecorated_out = msvc_demangler_to_string(out);
+	return true;
+}
+
+
+void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, char const* const str, int const len)
+{
+	assert(len >= 0);
+	if(buf.m_cap - buf.m_len <= len)
+	{
+		int const new_cap = (std::max)(64, (buf.m_len + len + 1) * 2);
+		char* const new_data = st.m_alc->allocate_objects<char>(new_cap);
+		if(buf.m_len != 0)
+		{
+			std::memcpy(new_data, buf.m_data, buf.m_len);
+		}
+		buf.m_data = new_data;
+		buf.m_cap = new_cap;
+	}
+	if(len != 0)
+	{
+		std::memcpy(buf.m_data + buf.m_len, str, len);
+	}
+	buf.m_len += len;
+	buf.m_data[buf.m_len] = '\0';
+}
+
+void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, char const* const str)
+{
+	msvc_demangler_append(st, buf, str, static_cast<int>(std::strlen(str)));
+}
+
+void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, string const& str)
+{
+	msvc_demangler_append(st, buf, str.m_str, str.m_len);
+}
+
+void msvc_demangler_append(msvc_demangler_state& st, msvc_demangler_buffer& buf, msvc_demangler_buffer const& str)
+{
+	msvc_demangler_append(st, buf, str.m_data, str.m_len);
+}
+
+void msvc_demangler_append_number(msvc_demangler_state& st, msvc_demangler_buffer& buf, std::int64_t const number)
+{
+	char tmp[24];
+	int const printed = std::snprintf(tmp, std::size(tmp), "%lld", static_cast<long long>(number));
+	assert(printed > 0 && printed < static_cast<int>(std::size(tmp)));
+	msvc_demangler_append(st, buf, tmp, printed);
+}
+
+string msvc_demangler_to_string(msvc_demangler_buffer const& buf)
+{
+	return buf.m_data ? string{buf.m_data, buf.m_len} : string{"", 0};
+}
+
+bool msvc_demangler_consume(msvc_demangler_state& st, char const ch)
+{
+	if(st.m_cur != st.m_end && *st.m_cur == ch)
+	{
+		++st.m_cur;
+		return true;
+	}
+	return false;
+}
+
+bool msvc_demangler_consume(msvc_demangler_state& st, char const* const prefix)
+{
+	std::size_t const len = std::strlen(prefix);
+	if(static_cast<std::size_t>(st.m_end - st.m_cur) >= len && std::memcmp(st.m_cur, prefix, len) == 0)
+	{
+		st.m_cur += len;
+		return true;
+	}
+	return false;
+}
+
+bool msvc_demangler_cv(msvc_demangler_state& st, int* const cv_out)
+{
+	assert(cv_out);
+	if(st.m_cur == st.m_end || *st.m_cur < 'A' || *st.m_cur > 'D')
+	{
+		return false;
+	}
+	*cv_out = *st.m_cur - 'A';
+	++st.m_cur;
+	return true;
+}
+
+bool msvc_demangler_number(msvc_demangler_state& st, std::int64_t* const number_out)
+{
+	assert(number_out);
+	bool const is_negative = msvc_demangler_consume(st, '?');
+	if(st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	if(*st.m_cur >= '0' && *st.m_cur <= '9')
+	{
+		std::int64_t const number = *st.m_cur - '0' + 1;
+		++st.m_cur;
+		*number_out = is_negative ? -number : number;
+		return true;
+	}
+	std::uint64_t number = 0;
+	int digits = 0;
+	while(st.m_cur != st.m_end && *st.m_cur != '@')
+	{
+		if(*st.m_cur < 'A' || *st.m_cur > 'P' || digits == 16)
+		{
+			return false;
+		}
+		number = number * 16 + static_cast<std::uint64_t>(*st.m_cur - 'A');
+		++digits;
+		++st.m_cur;
+	}
+	if(!msvc_demangler_consume(st, '@'))
+	{
+		return false;
+	}
+	*number_out = is_negative ? -static_cast<std::int64_t>(number) : static_cast<std::int64_t>(number);
+	return true;
+}
+
+void msvc_demangler_memorize_name(msvc_demangler_state& st, string const& name)
+{
+	msvc_demangler_backrefs& refs = *st.m_refs;
+	if(refs.m_names_count == static_cast<int>(std::size(refs.m_names)))
+	{
+		return;
+	}
+	bool const is_known = std::any_of(refs.m_names, refs.m_names + refs.m_names_count, [&](string const& e){ return e.m_len == name.m_len && std::memcmp(e.m_str, name.m_str, name.m_len) == 0; });
+	if(is_known)
+	{
+		return;
+	}
+	refs.m_names[refs.m_names_count++] = name;
+}
+
+bool msvc_demangler_symbol(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	if(++st.m_depth > s_msvc_demangler_max_depth || !msvc_demangler_consume(st, '?'))
+	{
+		return false;
+	}
+	if(msvc_demangler_consume(st, "?_C@"))
+	{
+		st.m_cur = st.m_end;
+		msvc_demangler_append(st, out, "`string'");
+		return true;
+	}
+	if(msvc_demangler_consume(st, "?_R0"))
+	{
+		msvc_demangler_buffer type{};
+		if(!msvc_demangler_type(st, type) || !msvc_demangler_consume(st, "@8"))
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, type);
+		msvc_demangler_append(st, out, " `RTTI Type Descriptor'");
+		--st.m_depth;
+		return true;
+	}
+	msvc_demangler_buffer name{};
+	msvc_demangler_special special = msvc_demangler_special::e_none;
+	if(!msvc_demangler_qualified_name(st, name, &special))
+	{
+		return false;
+	}
+	bool ret;
+	if(st.m_cur == st.m_end)
+	{
+		msvc_demangler_append(st, out, name);
+		ret = true;
+	}
+	else
+	{
+		char const code = *st.m_cur++;
+		if(code >= '0' && code <= '4')
+		{
+			ret = msvc_demangler_variable(st, code, name, out);
+		}
+		else if(code == '6' || code == '7')
+		{
+			ret = msvc_demangler_table(st, name, out);
+		}
+		else if(code == '8')
+		{
+			msvc_demangler_append(st, out, name);
+			ret = true;
+		}
+		else if(code >= 'A' && code <= 'Z')
+		{
+			ret = msvc_demangler_function(st, code, name, special, out);
+		}
+		else
+		{
+			ret = false;
+		}
+	}
+	--st.m_depth;
+	return ret;
+}
+
+bool msvc_demangler_qualified_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out)
+{
+	msvc_demangler_buffer components[s_msvc_demangler_max_components]{};
+	int n = 0;
+	if(special_out)
+	{
+		if(!msvc_demangler_leaf_name(st, components[n++], special_out))
+		{
+			return false;
+		}
+	}
+	while(!msvc_demangler_consume(st, '@'))
+	{
+		if(n == s_msvc_demangler_max_components || !msvc_demangler_scope_name(st, components[n++]))
+		{
+			return false;
+		}
+	}
+	if(n == 0)
+	{
+		return false;
+	}
+	if(special_out && (*special_out == msvc_demangler_special::e_ctor || *special_out == msvc_demangler_special::e_dtor))
+	{
+		if(n < 2)
+		{
+			return false;
+		}
+		msvc_demangler_append(st, components[0], components[1]);
+	}
+	for(int i = n - 1; i >= 0; --i)
+	{
+		msvc_demangler_append(st, out, components[i]);
+		if(i != 0)
+		{
+			msvc_demangler_append(st, out, "::", 2);
+		}
+	}
+	return true;
+}
+
+bool msvc_demangler_leaf_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out)
+{
+	assert(special_out);
+	if(msvc_demangler_consume(st, "?$"))
+	{
+		return msvc_demangler_template_name(st, false, out);
+	}
+	if(msvc_demangler_consume(st, '?'))
+	{
+		return msvc_demangler_operator_name(st, out, special_out);
+	}
+	string name;
+	bool const got_name = (st.m_cur != st.m_end && *st.m_cur >= '0' && *st.m_cur <= '9') ? msvc_demangler_back_ref_name(st, &name) : msvc_demangler_simple_name(st, true, &name);
+	if(!got_name)
+	{
+		return false;
+	}
+	msvc_demangler_append(st, out, name);
+	return true;
+}
+
+bool msvc_demangler_operator_name(msvc_demangler_state& st, msvc_demangler_buffer& out, msvc_demangler_special* const special_out)
+{
+	assert(special_out);
+	if(st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	char const code = *st.m_cur++;
+	if(code == '0' || code == '1')
+	{
+		*special_out = code == '0' ? msvc_demangler_special::e_ctor : msvc_demangler_special::e_dtor;
+		if(code == '1')
+		{
+			msvc_demangler_append(st, out, "~", 1);
+		}
+		return true;
+	}
+	if(code == 'B')
+	{
+		*special_out = msvc_demangler_special::e_conversion;
+		msvc_demangler_append(st, out, "operator ");
+		return true;
+	}
+	if(code != '_')
+	{
+		int const idx = code >= '0' && code <= '9' ? code - '0' : code >= 'A' && code <= 'Z' ? code - 'A' + 10 : -1;
+		if(idx < 0 || idx >= static_cast<int>(std::size(s_msvc_demangler_operators)) || !s_msvc_demangler_operators[idx])
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, s_msvc_demangler_operators[idx]);
+		return true;
+	}
+	if(st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	char const code_ex = *st.m_cur++;
+	if(code_ex == '_')
+	{
+		if(msvc_demangler_consume(st, 'L'))
+		{
+			msvc_demangler_append(st, out, "operator co_await");
+			return true;
+		}
+		if(msvc_demangler_consume(st, 'M'))
+		{
+			msvc_demangler_append(st, out, "operator<=>");
+			return true;
+		}
+		return false;
+	}
+	if(code_ex == 'R')
+	{
+		if(st.m_cur == st.m_end)
+		{
+			return false;
+		}
+		char const code_rtti = *st.m_cur++;
+		if(code_rtti == '1')
+		{
+			std::int64_t numbers[4];
+			for(std::int64_t& number : numbers)
+			{
+				if(!msvc_demangler_number(st, &number))
+				{
+					return false;
+				}
+			}
+			msvc_demangler_append(st, out, "`RTTI Base Class Descriptor at (");
+			for(int i = 0; i != static_cast<int>(std::size(numbers)); ++i)
+			{
+				msvc_demangler_append_number(st, out, numbers[i]);
+				msvc_demangler_append(st, out, i != static_cast<int>(std::size(numbers)) - 1 ? "," : ")'");
+			}
+			return true;
+		}
+		int const idx = code_rtti - '0';
+		if(idx < 0 || idx >= static_cast<int>(std::size(s_msvc_demangler_rtti)) || !s_msvc_demangler_rtti[idx])
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, s_msvc_demangler_rtti[idx]);
+		return true;
+	}
+	int const idx = code_ex >= '0' && code_ex <= '9' ? code_ex - '0' : code_ex >= 'A' && code_ex <= 'Z' ? code_ex - 'A' + 10 : -1;
+	if(idx < 0 || idx >= static_cast<int>(std::size(s_msvc_demangler_operators_ex)) || !s_msvc_demangler_operators_ex[idx])
+	{
+		return false;
+	}
+	msvc_demangler_append(st, out, s_msvc_demangler_operators_ex[idx]);
+	return true;
+}
+
+bool msvc_demangler_scope_name(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	if(st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	if(*st.m_cur >= '0' && *st.m_cur <= '9')
+	{
+		string name;
+		if(!msvc_demangler_back_ref_name(st, &name))
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, name);
+		return true;
+	}
+	if(msvc_demangler_consume(st, "?$"))
+	{
+		return msvc_demangler_template_name(st, true, out);
+	}
+	if(msvc_demangler_consume(st, "?A"))
+	{
+		string key;
+		if(!msvc_demangler_simple_name(st, false, &key))
+		{
+			return false;
+		}
+		static constexpr char const s_anonymous[] = "`anonymous namespace'";
+		msvc_demangler_append(st, out, s_anonymous);
+		msvc_demangler_memorize_name(st, string{s_anonymous, static_cast<int>(std::size(s_anonymous)) - 1});
+		return true;
+	}
+	if(msvc_demangler_consume(st, '?'))
+	{
+		std::int64_t number;
+		if(!msvc_demangler_number(st, &number) || !msvc_demangler_consume(st, '?'))
+		{
+			return false;
+		}
+		msvc_demangler_backrefs refs{};
+		msvc_demangler_backrefs* const outer = st.m_refs;
+		st.m_refs = &refs;
+		msvc_demangler_buffer nested{};
+		if(!msvc_demangler_symbol(st, nested))
+		{
+			return false;
+		}
+		st.m_refs = outer;
+		msvc_demangler_append(st, out, "`", 1);
+		msvc_demangler_append(st, out, nested);
+		msvc_demangler_append(st, out, "'::`", 4);
+		msvc_demangler_append_number(st, out, number);
+		msvc_demangler_append(st, out, "'", 1);
+		return true;
+	}
+	string name;
+	if(!msvc_demangler_simple_name(st, true, &name))
+	{
+		return false;
+	}
+	msvc_demangler_append(st, out, name);
+	return true;
+}
+
+bool msvc_demangler_simple_name(msvc_demangler_state& st, bool const memorize, string* const name_out)
+{
+	assert(name_out);
+	char const* const begin = st.m_cur;
+	char const* const at = std::find(begin, st.m_end, '@');
+	if(at == st.m_end || at == begin)
+	{
+		return false;
+	}
+	st.m_cur = at + 1;
+	*name_out = string{begin, static_cast<int>(at - begin)};
+	if(memorize)
+	{
+		msvc_demangler_memorize_name(st, *name_out);
+	}
+	return true;
+}
+
+bool msvc_demangler_back_ref_name(msvc_demangler_state& st, string* const name_out)
+{
+	assert(name_out);
+	assert(st.m_cur != st.m_end);
+	int const idx = *st.m_cur++ - '0';
+	if(idx >= st.m_refs->m_names_count)
+	{
+		return false;
+	}
+	*name_out = st.m_refs->m_names[idx];
+	return true;
+}
+
+bool msvc_demangler_template_name(msvc_demangler_state& st, bool const memorize, msvc_demangler_buffer& out)
+{
+	if(++st.m_depth > s_msvc_demangler_max_depth)
+	{
+		return false;
+	}
+	msvc_demangler_backrefs refs{};
+	msvc_demangler_backrefs* const outer = st.m_refs;
+	st.m_refs = &refs;
+	msvc_demangler_buffer buf{};
+	if(msvc_demangler_consume(st, '?'))
+	{
+		msvc_demangler_special special = msvc_demangler_special::e_none;
+		if(!msvc_demangler_operator_name(st, buf, &special) || special != msvc_demangler_special::e_none)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		string name;
+		if(!msvc_demangler_simple_name(st, true, &name))
+		{
+			return false;
+		}
+		msvc_demangler_append(st, buf, name);
+	}
+	msvc_demangler_append(st, buf, "<", 1);
+	bool is_first = true;
+	while(!msvc_demangler_consume(st, '@'))
+	{
+		if(msvc_demangler_consume(st, "$$$V") || msvc_demangler_consume(st, "$$V") || msvc_demangler_consume(st, "$$Z") || msvc_demangler_consume(st, "$S"))
+		{
+			continue;
+		}
+		if(!is_first)
+		{
+			msvc_demangler_append(st, buf, ",", 1);
+		}
+		if(!msvc_demangler_template_arg(st, buf))
+		{
+			return false;
+		}
+		is_first = false;
+	}
+	if(buf.m_data[buf.m_len - 1] == '>')
+	{
+		msvc_demangler_append(st, buf, " ", 1);
+	}
+	msvc_demangler_append(st, buf, ">", 1);
+	st.m_refs = outer;
+	if(memorize)
+	{
+		msvc_demangler_memorize_name(st, msvc_demangler_to_string(buf));
+	}
+	msvc_demangler_append(st, out, buf);
+	--st.m_depth;
+	return true;
+}
+
+bool msvc_demangler_template_arg(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	if(msvc_demangler_consume(st, "$0"))
+	{
+		std::int64_t number;
+		if(!msvc_demangler_number(st, &number))
+		{
+			return false;
+		}
+		msvc_demangler_append_number(st, out, number);
+		return true;
+	}
+	if(msvc_demangler_consume(st, "$1"))
+	{
+		msvc_demangler_backrefs refs{};
+		msvc_demangler_backrefs* const outer = st.m_refs;
+		st.m_refs = &refs;
+		msvc_demangler_append(st, out, "&", 1);
+		if(!msvc_demangler_symbol(st, out))
+		{
+			return false;
+		}
+		st.m_refs = outer;
+		return true;
+	}
+	if(st.m_end - st.m_cur >= 2 && st.m_cur[0] == '$' && st.m_cur[1] != '$')
+	{
+		return false;
+	}
+	return msvc_demangler_type(st, out);
+}
+
+bool msvc_demangler_variable(msvc_demangler_state& st, char const code, msvc_demangler_buffer const& name, msvc_demangler_buffer& out)
+{
+	msvc_demangler_buffer type{};
+	if(!msvc_demangler_type(st, type))
+	{
+		return false;
+	}
+	while(msvc_demangler_consume(st, 'E') || msvc_demangler_consume(st, 'I') || msvc_demangler_consume(st, 'F'))
+	{
+	}
+	int cv;
+	if(!msvc_demangler_cv(st, &cv))
+	{
+		return false;
+	}
+	msvc_demangler_append(st, out, s_msvc_demangler_data_accesses[code - '0']);
+	msvc_demangler_append(st, out, type);
+	msvc_demangler_append(st, out, s_msvc_demangler_cvs[cv]);
+	msvc_demangler_append(st, out, " ", 1);
+	msvc_demangler_append(st, out, name);
+	return true;
+}
+
+bool msvc_demangler_table(msvc_demangler_state& st, msvc_demangler_buffer const& name, msvc_demangler_buffer& out)
+{
+	int cv;
+	if(!msvc_demangler_cv(st, &cv))
+	{
+		return false;
+	}
+	static constexpr char const* const s_table_cvs[] = {"", "const ", "volatile ", "const volatile "};
+	msvc_demangler_append(st, out, s_table_cvs[cv]);
+	msvc_demangler_append(st, out, name);
+	bool is_first = true;
+	while(!msvc_demangler_consume(st, '@'))
+	{
+		msvc_demangler_buffer scope{};
+		if(!msvc_demangler_qualified_name(st, scope, nullptr))
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, is_first ? "{for `" : "s `");
+		msvc_demangler_append(st, out, scope);
+		msvc_demangler_append(st, out, "'", 1);
+		is_first = false;
+	}
+	if(!is_first)
+	{
+		msvc_demangler_append(st, out, "}", 1);
+	}
+	return true;
+}
+
+bool msvc_demangler_function(msvc_demangler_state& st, char const code, msvc_demangler_buffer const& name, msvc_demangler_special const special, msvc_demangler_buffer& out)
+{
+	bool const is_member = code <= 'X';
+	int const kind = is_member ? ((code - 'A') % 8) / 2 : 1;
+	if(kind == 3)
+	{
+		return false;
+	}
+	bool is_ptr64 = false;
+	char const* ref_qualifier = "";
+	int this_cv = 0;
+	if(kind != 1)
+	{
+		for(;;)
+		{
+			if(msvc_demangler_consume(st, 'E'))
+			{
+				is_ptr64 = true;
+			}
+			else if(msvc_demangler_consume(st, 'G'))
+			{
+				ref_qualifier = " &";
+			}
+			else if(msvc_demangler_consume(st, 'H'))
+			{
+				ref_qualifier = " &&";
+			}
+			else if(!msvc_demangler_consume(st, 'I') && !msvc_demangler_consume(st, 'F'))
+			{
+				break;
+			}
+		}
+		if(!msvc_demangler_cv(st, &this_cv))
+		{
+			return false;
+		}
+	}
+	char const* calling_convention;
+	msvc_demangler_buffer return_type{};
+	msvc_demangler_buffer args{};
+	if(!msvc_demangler_calling_convention(st, &calling_convention) || !msvc_demangler_return_type(st, return_type) || !msvc_demangler_args(st, args) || !msvc_demangler_throw_spec(st))
+	{
+		return false;
+	}
+	if(is_member)
+	{
+		msvc_demangler_append(st, out, s_msvc_demangler_accesses[(code - 'A') / 8]);
+		if(kind == 1)
+		{
+			msvc_demangler_append(st, out, "static ");
+		}
+		else if(kind == 2)
+		{
+			msvc_demangler_append(st, out, "virtual ");
+		}
+	}
+	if(return_type.m_len != 0 && special != msvc_demangler_special::e_conversion)
+	{
+		msvc_demangler_append(st, out, return_type);
+		msvc_demangler_append(st, out, " ", 1);
+	}
+	msvc_demangler_append(st, out, calling_convention);
+	msvc_demangler_append(st, out, " ", 1);
+	msvc_demangler_append(st, out, name);
+	if(special == msvc_demangler_special::e_conversion)
+	{
+		msvc_demangler_append(st, out, return_type);
+	}
+	msvc_demangler_append(st, out, args);
+	if(kind != 1)
+	{
+		msvc_demangler_append(st, out, s_msvc_demangler_cvs[this_cv]);
+		msvc_demangler_append(st, out, ref_qualifier);
+		if(is_ptr64)
+		{
+			msvc_demangler_append(st, out, " __ptr64");
+		}
+	}
+	return true;
+}
+
+bool msvc_demangler_calling_convention(msvc_demangler_state& st, char const** const calling_convention_out)
+{
+	assert(calling_convention_out);
+	if(st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	int const idx = (*st.m_cur - 'A') / 2;
+	if(*st.m_cur < 'A' || idx >= static_cast<int>(std::size(s_msvc_demangler_calling_conventions)) || !s_msvc_demangler_calling_conventions[idx])
+	{
+		return false;
+	}
+	++st.m_cur;
+	*calling_convention_out = s_msvc_demangler_calling_conventions[idx];
+	return true;
+}
+
+bool msvc_demangler_return_type(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	if(msvc_demangler_consume(st, '@'))
+	{
+		return true;
+	}
+	return msvc_demangler_type(st, out);
+}
+
+bool msvc_demangler_args(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	msvc_demangler_append(st, out, "(", 1);
+	if(msvc_demangler_consume(st, 'X'))
+	{
+		msvc_demangler_append(st, out, "void)");
+		return true;
+	}
+	bool is_first = true;
+	for(;;)
+	{
+		if(msvc_demangler_consume(st, '@'))
+		{
+			break;
+		}
+		if(msvc_demangler_consume(st, 'Z'))
+		{
+			msvc_demangler_append(st, out, is_first ? "..." : ",...");
+			break;
+		}
+		if(st.m_cur == st.m_end)
+		{
+			return false;
+		}
+		char const* const begin = st.m_cur;
+		msvc_demangler_buffer arg{};
+		if(!msvc_demangler_type(st, arg))
+		{
+			return false;
+		}
+		msvc_demangler_backrefs& refs = *st.m_refs;
+		if(st.m_cur - begin > 1 && refs.m_types_count != static_cast<int>(std::size(refs.m_types)))
+		{
+			refs.m_types[refs.m_types_count++] = msvc_demangler_to_string(arg);
+		}
+		if(!is_first)
+		{
+			msvc_demangler_append(st, out, ",", 1);
+		}
+		msvc_demangler_append(st, out, arg);
+		is_first = false;
+	}
+	msvc_demangler_append(st, out, ")", 1);
+	return true;
+}
+
+bool msvc_demangler_throw_spec(msvc_demangler_state& st)
+{
+	if(msvc_demangler_consume(st, "_E"))
+	{
+		return msvc_demangler_consume(st, 'Z');
+	}
+	return msvc_demangler_consume(st, 'Z') || st.m_cur == st.m_end;
+}
+
+bool msvc_demangler_type(msvc_demangler_state& st, msvc_demangler_buffer& out)
+{
+	if(++st.m_depth > s_msvc_demangler_max_depth || st.m_cur == st.m_end)
+	{
+		return false;
+	}
+	char const code = *st.m_cur++;
+	bool ret;
+	if(code >= '0' && code <= '9')
+	{
+		int const idx = code - '0';
+		ret = idx < st.m_refs->m_types_count;
+		if(ret)
+		{
+			msvc_demangler_append(st, out, st.m_refs->m_types[idx]);
+		}
+	}
+	else if(code >= 'A' && code - 'A' < static_cast<int>(std::size(s_msvc_demangler_primitives)) && s_msvc_demangler_primitives[code - 'A'])
+	{
+		msvc_demangler_append(st, out, s_msvc_demangler_primitives[code - 'A']);
+		ret = true;
+	}
+	else if(code == '_')
+	{
+		ret = st.m_cur != st.m_end && *st.m_cur >= 'A' && *st.m_cur - 'A' < static_cast<int>(std::size(s_msvc_demangler_primitives_ex)) && s_msvc_demangler_primitives_ex[*st.m_cur - 'A'];
+		if(ret)
+		{
+			msvc_demangler_append(st, out, s_msvc_demangler_primitives_ex[*st.m_cur++ - 'A']);
+		}
+	}
+	else if(code == 'T' || code == 'U' || code == 'V' || code == 'W')
+	{
+		static constexpr char const* const s_keywords[] = {"union ", "struct ", "class ", "enum "};
+		ret = code != 'W' || (st.m_cur != st.m_end && *st.m_cur >= '0' && *st.m_cur <= '7' && ++st.m_cur);
+		if(ret)
+		{
+			msvc_demangler_append(st, out, s_keywords[code - 'T']);
+			ret = msvc_demangler_qualified_name(st, out, nullptr);
+		}
+	}
+	else if(code == 'A' || code == 'B')
+	{
+		ret = msvc_demangler_pointer(st, "&", code - 'A' ? 2 : 0, out);
+	}
+	else if(code >= 'P' && code <= 'S')
+	{
+		ret = msvc_demangler_pointer(st, "*", code - 'P', out);
+	}
+	else if(code == '?')
+	{
+		int cv;
+		ret = msvc_demangler_cv(st, &cv) && msvc_demangler_type(st, out);
+		if(ret)
+		{
+			msvc_demangler_append(st, out, s_msvc_demangler_cvs[cv]);
+		}
+	}
+	else if(code == '$' && msvc_demangler_consume(st, '$'))
+	{
+		if(msvc_demangler_consume(st, 'Q') || msvc_demangler_consume(st, 'R'))
+		{
+			ret = msvc_demangler_pointer(st, "&&", st.m_cur[-1] == 'R' ? 2 : 0, out);
+		}
+		else if(msvc_demangler_consume(st, 'T'))
+		{
+			msvc_demangler_append(st, out, "std::nullptr_t");
+			ret = true;
+		}
+		else if(msvc_demangler_consume(st, 'B'))
+		{
+			ret = msvc_demangler_type(st, out);
+		}
+		else if(msvc_demangler_consume(st, 'C'))
+		{
+			int cv;
+			ret = msvc_demangler_cv(st, &cv) && msvc_demangler_type(st, out);
+			if(ret)
+			{
+				msvc_demangler_append(st, out, s_msvc_demangler_cvs[cv]);
+			}
+		}
+		else
+		{
+			ret = false;
+		}
+	}
+	else
+	{
+		ret = false;
+	}
+	--st.m_depth;
+	return ret;
+}
+
+bool msvc_demangler_pointer(msvc_demangler_state& st, char const* const declarator, int const pointer_cv, msvc_demangler_buffer& out)
+{
+	bool is_ptr64 = false;
+	bool is_restrict = false;
+	for(;;)
+	{
+		if(msvc_demangler_consume(st, 'E'))
+		{
+			is_ptr64 = true;
+		}
+		else if(msvc_demangler_consume(st, 'I'))
+		{
+			is_restrict = true;
+		}
+		else if(!msvc_demangler_consume(st, 'F'))
+		{
+			break;
+		}
+	}
+	if(msvc_demangler_consume(st, '6'))
+	{
+		char const* calling_convention;
+		msvc_demangler_buffer return_type{};
+		msvc_demangler_buffer args{};
+		if(!msvc_demangler_calling_convention(st, &calling_convention) || !msvc_demangler_return_type(st, return_type) || !msvc_demangler_args(st, args) || !msvc_demangler_throw_spec(st))
+		{
+			return false;
+		}
+		msvc_demangler_append(st, out, return_type);
+		msvc_demangler_append(st, out, " (", 2);
+		msvc_demangler_append(st, out, calling_convention);
+		msvc_demangler_append(st, out, declarator);
+		msvc_demangler_append(st, out, s_msvc_demangler_cvs[pointer_cv]);
+		if(is_ptr64)
+		{
+			msvc_demangler_append(st, out, " __ptr64");
+		}
+		msvc_demangler_append(st, out, ")", 1);
+		msvc_demangler_append(st, out, args);
+		return true;
+	}
+	int pointee_cv;
+	if(!msvc_demangler_cv(st, &pointee_cv) || (st.m_cur != st.m_end && *st.m_cur == 'Y'))
+	{
+		return false;
+	}
+	if(!msvc_demangler_type(st, out))
+	{
+		return false;
+	}
+	msvc_demangler_append(st, out, s_msvc_demangler_cvs[pointee_cv]);
+	msvc_demangler_append(st, out, " ", 1);
+	msvc_demangler_append(st, out, declarator);
+	msvc_demangler_append(st, out, s_msvc_demangler_cvs[pointer_cv]);
+	if(is_ptr64)
+	{
+		msvc_demangler_append(st, out, " __ptr64");
+	}
+	if(is_restrict)
+	{
+		msvc_demangler_append(st, out, " __restrict");
+	}
+	return true;
+}
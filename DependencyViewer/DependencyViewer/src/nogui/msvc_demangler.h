@@ -0,0 +1,10 @@
+#pragma once
+
+
+#include "my_string.h"
+
+
+class allocator;
+
+
+bool msvc_demangle(char const* const decorated, int const len, allocator& alc, string* const undecorated_out);
@@ -1,10 +1,10 @@
-#pragma once
-
-
-namespace my_actctx
-{
-	void create();
-	void destroy();
-	void activate();
-	void deactivate();
-}
+#pragma once
+
+
+namespace my_actctx
+{
+	void create();
+	void destroy();
+	void activate();
+	void deactivate();
+}
@@ -1 +1 @@
-#include "my_string_handle.h"
+#include "my_string_handle.h"
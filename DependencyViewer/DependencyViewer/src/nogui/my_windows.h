@@ -1,18 +1,18 @@
-#pragma once
-
-
-#define CINTERFACE
-#define WIN32_LEAN_AND_MEAN
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif
-#ifdef ISOLATION_AWARE_ENABLED
-#undef ISOLATION_AWARE_ENABLED
-#endif
-
-
-#include <windows.h>
-
-
-typedef GUID* PGUID;
-typedef DWORD DEVICE_TYPE;
+#pragma once
+
+
+#define CINTERFACE
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifdef ISOLATION_AWARE_ENABLED
+#undef ISOLATION_AWARE_ENABLED
+#endif
+
+
+#include <windows.h>
+
+
+typedef GUID* PGUID;
+typedef DWORD DEVICE_TYPE;
@@ -0,0 +1,166 @@
+#include "offline_image.h"
+
+#include "api_set.h"
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "file_system.h"
+#include "registry_hive.h"
+#include "search_plan.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+static std::mutex g_offline_images_mutex;
+static std::unordered_map<std::wstring, std::unique_ptr<offline_image>>* g_offline_images = nullptr;
+
+
+static bool offline_image_load(std::wstring const& root, offline_image* const image_out);
+static std::string offline_image_get_control_set(registry_hive const& hive);
+static bool offline_image_starts_with_i(std::wstring const& str, std::wstring const& prefix);
+
+
+void offline_images::deinit()
+{
+	std::lock_guard<std::mutex> const lck(g_offline_images_mutex);
+	if(g_offline_images)
+	{
+		delete g_offline_images;
+		g_offline_images = nullptr;
+	}
+}
+
+offline_image* offline_images::get(std::wstring const& root)
+{
+	std::wstring key = root;
+	while(key.size() > 1 && (key.back() == L'\\' || key.back() == L'/'))
+	{
+		key.pop_back();
+	}
+	std::transform(key.begin(), key.end(), key.begin(), [](wchar_t const& ch){ return to_lowercase(ch); });
+	std::lock_guard<std::mutex> const lck(g_offline_images_mutex);
+	if(!g_offline_images)
+	{
+		g_offline_images = new std::unordered_map<std::wstring, std::unique_ptr<offline_image>>();
+	}
+	auto const it = g_offline_images->find(key);
+	if(it != g_offline_images->end())
+	{
+		return it->second.get();
+	}
+	std::unique_ptr<offline_image> image = std::make_unique<offline_image>();
+	bool const loaded = offline_image_load(root, image.get());
+	WARN_M_R(loaded, L"Failed to offline_image_load.", nullptr);
+	return g_offline_images->emplace(std::move(key), std::move(image)).first->second.get();
+}
+
+
+void make_offline_search_plan(offline_image& image, search_plan* const plan_out)
+{
+	assert(plan_out);
+	search_plan& plan = *plan_out;
+	search_plan_use_sxs_catalog(&plan, &image.m_sxs_catalog);
+	plan.m_known_dlls_path = image.m_system32;
+	plan.m_known_dlls = image.m_known_dlls;
+	plan.m_system32 = image.m_system32;
+	plan.m_api_set = api_set_schemas::get(image.m_system32);
+	plan.m_windows = image.m_windows;
+	plan.m_current_dir.clear();
+	plan.m_path_dirs = image.m_path_dirs;
+	plan.m_fs = get_native_file_system();
+}
+
+
+bool offline_image_load(std::wstring const& root, offline_image* const image_out)
+{
+	assert(image_out);
+	offline_image& image = *image_out;
+	image.m_root = root;
+	image.m_windows = std::filesystem::path{root}.append(L"Windows").wstring();
+	image.m_system32 = std::filesystem::path{image.m_windows}.append(L"System32").wstring();
+	std::wstring const hive_path = std::filesystem::path{image.m_system32}.append(L"config").append(L"SYSTEM").wstring();
+	registry_hive hive;
+	bool const hive_inited = hive.init(hive_path.c_str());
+	WARN_M_R(hive_inited, L"Failed to init registry_hive.", false);
+	std::string const session_manager_path = offline_image_get_control_set(hive) + "\\Control\\Session Manager";
+	std::uint32_t const session_manager = hive.find_key(hive.get_root_key(), session_manager_path);
+	WARN_M_R(session_manager != 0, L"Session Manager key not found in registry hive.", false);
+	std::vector<registry_hive_value> values;
+	std::uint32_t const known_dlls = hive.find_key(session_manager, "KnownDLLs");
+	if(known_dlls != 0 && hive.get_values(known_dlls, &values))
+	{
+		for(registry_hive_value const& value : values)
+		{
+			std::string value_name(value.m_name.size(), '\0');
+			std::transform(value.m_name.begin(), value.m_name.end(), value_name.begin(), [](char const& ch){ return to_lowercase(ch); });
+			if(value_name.starts_with("dlldirectory") || value.m_string.empty() || !is_ascii(value.m_string.c_str(), static_cast<int>(value.m_string.size())))
+			{
+				continue;
+			}
+			std::string name(value.m_string.size(), '\0');
+			std::transform(value.m_string.begin(), value.m_string.end(), name.begin(), [](wchar_t const& ch){ return static_cast<char>(to_lowercase(ch)); });
+			image.m_known_dlls.insert(std::move(name));
+		}
+	}
+	std::uint32_t const environment = hive.find_key(session_manager, "Environment");
+	if(environment != 0 && hive.get_values(environment, &values))
+	{
+		auto const path_value = std::find_if(values.begin(), values.end(), [](registry_hive_value const& e){ return e.m_name.size() == 4 && std::equal(e.m_name.begin(), e.m_name.end(), "path", [](char const& a, char const& b){ return to_lowercase(a) == b; }); });
+		std::wstring const& path = path_value != values.end() ? path_value->m_string : std::wstring{};
+		static std::wstring const s_system_root = L"%SystemRoot%";
+		static std::wstring const s_windir = L"%windir%";
+		std::size_t pos = 0;
+		while(pos < path.size())
+		{
+			std::size_t const sep = std::min(path.find(L';', pos), path.size());
+			std::wstring dir = path.substr(pos, sep - pos);
+			pos = sep + 1;
+			std::wstring const* const var = offline_image_starts_with_i(dir, s_system_root) ? &s_system_root : offline_image_starts_with_i(dir, s_windir) ? &s_windir : nullptr;
+			if(var)
+			{
+				dir.replace(0, var->size(), image.m_windows);
+			}
+			// Anything still referring to the environment or to another drive cannot be rooted in the image.
+			if(dir.empty() || dir.find(L'%') != std::wstring::npos || (!var && dir.size() >= 2 && dir[1] == L':'))
+			{
+				continue;
+			}
+			std::replace(dir.begin(), dir.end(), L'\\', static_cast<wchar_t>(std::filesystem::path::preferred_separator));
+			image.m_path_dirs.push_back(std::move(dir));
+		}
+	}
+	std::wstring const winsxs = std::filesystem::path{image.m_windows}.append(L"WinSxS").wstring();
+	bool const catalog_inited = image.m_sxs_catalog.init(winsxs);
+	WARN_M(catalog_inited, L"Failed to init sxs_catalog.");
+	return true;
+}
+
+std::string offline_image_get_control_set(registry_hive const& hive)
+{
+	std::uint32_t current = 1;
+	std::uint32_t const select = hive.find_key(hive.get_root_key(), "Select");
+	std::vector<registry_hive_value> values;
+	if(select != 0 && hive.get_values(select, &values))
+	{
+		auto const it = std::find_if(values.begin(), values.end(), [](registry_hive_value const& e){ return e.m_name == "Current"; });
+		if(it != values.end() && it->m_dword != 0 && it->m_dword <= 999)
+		{
+			current = it->m_dword;
+		}
+	}
+	char buff[16];
+	int const printed = std::snprintf(buff, std::size(buff), "ControlSet%03u", static_cast<unsigned>(current));
+	assert(printed > 0 && printed < static_cast<int>(std::size(buff)));
+	return std::string{buff, buff + printed};
+}
+
+bool offline_image_starts_with_i(std::wstring const& str, std::wstring const& prefix)
+{
+	return str.size() >= prefix.size() && std::equal(prefix.begin(), prefix.end(), str.begin(), [](wchar_t const& a, wchar_t const& b){ return to_lowercase(a) == to_lowercase(b); });
+}
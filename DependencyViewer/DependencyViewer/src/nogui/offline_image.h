@@ -0,0 +1,32 @@
+#pragma once
+
+
+#include "sxs_catalog.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+
+struct search_plan;
+
+
+struct offline_image
+{
+	std::wstring m_root;
+	std::wstring m_windows;
+	std::wstring m_system32;
+	std::unordered_set<std::string> m_known_dlls;
+	std::vector<std::wstring> m_path_dirs;
+	sxs_catalog m_sxs_catalog;
+};
+
+
+namespace offline_images
+{
+	void deinit();
+	offline_image* get(std::wstring const& root);
+}
+
+
+void make_offline_search_plan(offline_image& image, search_plan* const plan_out);
@@ -0,0 +1,186 @@
+#include "parallel_for.h"
+
+#include "cassert_my.h"
+#include "thread_name.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "my_windows.h"
+
+
+static constexpr unsigned const s_max_worker_count = 64;
+
+
+struct parallel_for_job
+{
+	int m_count;
+	parallel_for_function_t m_func;
+	parallel_for_param_t m_param;
+	int m_worker_count;
+	int m_next_worker;
+	int m_active;
+	std::atomic<int> m_next_idx;
+};
+
+
+class parallel_for_pool
+{
+public:
+	parallel_for_pool();
+	parallel_for_pool(parallel_for_pool const&) = delete;
+	parallel_for_pool& operator=(parallel_for_pool const&) = delete;
+	~parallel_for_pool();
+public:
+	void run(parallel_for_job& job);
+private:
+	void thread_func();
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_work_cv;
+	std::condition_variable m_done_cv;
+	std::vector<parallel_for_job*> m_jobs;
+	std::vector<std::thread> m_threads;
+	bool m_stop_requested;
+};
+
+
+static void parallel_for_work(parallel_for_job& job, int const worker_idx);
+static parallel_for_pool& parallel_for_get_pool();
+
+
+int parallel_for_worker_count()
+{
+	static int const s_worker_count = static_cast<int>((std::min)((std::max)(std::thread::hardware_concurrency(), 1u), s_max_worker_count));
+	return s_worker_count;
+}
+
+void parallel_for(int const count, parallel_for_function_t const func, parallel_for_param_t const param)
+{
+	assert(count >= 0);
+	assert(func);
+	int const worker_count = (std::min)(parallel_for_worker_count(), count);
+	if(worker_count <= 1)
+	{
+		for(int i = 0; i != count; ++i)
+		{
+			func(i, 0, param);
+		}
+		return;
+	}
+	parallel_for_job job;
+	job.m_count = count;
+	job.m_func = func;
+	job.m_param = param;
+	job.m_worker_count = worker_count;
+	job.m_next_worker = 1;
+	job.m_active = 0;
+	job.m_next_idx.store(0, std::memory_order_relaxed);
+	parallel_for_get_pool().run(job);
+}
+
+
+parallel_for_pool::parallel_for_pool() :
+	m_mutex(),
+	m_work_cv(),
+	m_done_cv(),
+	m_jobs(),
+	m_threads(),
+	m_stop_requested(false)
+{
+	int const thread_count = parallel_for_worker_count() - 1;
+	m_threads.reserve(thread_count);
+	for(int i = 0; i != thread_count; ++i)
+	{
+		parallel_for_pool* const self = this;
+		m_threads.emplace_back([self](){ self->thread_func(); });
+	}
+}
+
+parallel_for_pool::~parallel_for_pool()
+{
+	{
+		std::lock_guard<std::mutex> const lck(m_mutex);
+		m_stop_requested = true;
+	}
+	m_work_cv.notify_all();
+	for(std::thread& thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void parallel_for_pool::run(parallel_for_job& job)
+{
+	{
+		std::lock_guard<std::mutex> const lck(m_mutex);
+		m_jobs.push_back(&job);
+	}
+	m_work_cv.notify_all();
+	parallel_for_work(job, 0);
+	std::unique_lock<std::mutex> lck(m_mutex);
+	// Once the job is off the list no new worker can join, wait only for those already running it.
+	m_jobs.erase(std::find(m_jobs.begin(), m_jobs.end(), &job));
+	m_done_cv.wait(lck, [&](){ return job.m_active == 0; });
+}
+
+void parallel_for_pool::thread_func()
+{
+	name_current_thread("parallel_for", L"parallel_for");
+	// Threads inherit the activation context of whoever started the pool, workers must see the process default one.
+	ULONG_PTR actctx_cookie;
+	BOOL const actctx_activated = ActivateActCtx(nullptr, &actctx_cookie);
+	assert(actctx_activated != FALSE);
+	std::unique_lock<std::mutex> lck(m_mutex);
+	for(;;)
+	{
+		parallel_for_job* job = nullptr;
+		m_work_cv.wait(lck, [&]()
+		{
+			auto const it = std::find_if(m_jobs.begin(), m_jobs.end(), [](parallel_for_job const* const& e){ return e->m_next_worker != e->m_worker_count; });
+			job = it != m_jobs.end() ? *it : nullptr;
+			return m_stop_requested || job;
+		});
+		if(m_stop_requested)
+		{
+			break;
+		}
+		int const worker_idx = job->m_next_worker++;
+		++job->m_active;
+		lck.unlock();
+		parallel_for_work(*job, worker_idx);
+		lck.lock();
+		--job->m_active;
+		if(job->m_active == 0)
+		{
+			m_done_cv.notify_all();
+		}
+	}
+	lck.unlock();
+	BOOL const actctx_deactivated = DeactivateActCtx(0, actctx_cookie);
+	assert(actctx_deactivated != FALSE);
+}
+
+
+void parallel_for_work(parallel_for_job& job, int const worker_idx)
+{
+	for(;;)
+	{
+		int const idx = job.m_next_idx.fetch_add(1, std::memory_order_relaxed);
+		if(idx >= job.m_count)
+		{
+			break;
+		}
+		job.m_func(idx, worker_idx, job.m_param);
+	}
+}
+
+parallel_for_pool& parallel_for_get_pool()
+{
+	static parallel_for_pool s_pool;
+	return s_pool;
+}
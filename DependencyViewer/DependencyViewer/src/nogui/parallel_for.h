@@ -0,0 +1,9 @@
+#pragma once
+
+
+typedef void* parallel_for_param_t;
+typedef void(*parallel_for_function_t)(int const idx, int const worker_idx, parallel_for_param_t const param);
+
+
+int parallel_for_worker_count();
+void parallel_for(int const count, parallel_for_function_t const func, parallel_for_param_t const param);
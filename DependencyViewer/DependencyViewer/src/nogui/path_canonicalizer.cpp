@@ -0,0 +1,162 @@
+#include "path_canonicalizer.h"
+
+#include "cassert_my.h"
+
+#include <algorithm>
+#include <vector>
+
+
+static bool path_canonicalizer_is_separator(wchar_t const& ch);
+static int path_canonicalizer_root_len(wchar_t const* const path, int const path_len);
+static void path_canonicalizer_fold(std::wstring const& path, int const root_len, std::wstring* const out);
+static void path_canonicalizer_correct_case(path_canonicalizer const& pc, int const root_len, std::wstring* const path);
+
+
+bool canonicalize_path(path_canonicalizer const& pc, wchar_t const* const path, int const path_len, std::wstring* const out)
+{
+	assert(out);
+	if(path_len == 0)
+	{
+		return false;
+	}
+	bool const is_verbatim = path_len >= 4 && path[0] == L'\\' && path[1] == L'\\' && (path[2] == L'?' || path[2] == L'.') && path[3] == L'\\';
+	if(is_verbatim)
+	{
+		out->assign(path, path + path_len);
+		return true;
+	}
+	std::wstring full;
+	int const root_len = path_canonicalizer_root_len(path, path_len);
+	if(root_len != 0)
+	{
+		full.assign(path, path + path_len);
+	}
+	else
+	{
+		bool const is_rooted = path_canonicalizer_is_separator(path[0]);
+		bool const is_drive_relative = path_len >= 2 && path[1] == L':';
+		int const current_root_len = path_canonicalizer_root_len(pc.m_current_dir, pc.m_current_dir_len);
+		if(current_root_len == 0 && !is_drive_relative)
+		{
+			return false;
+		}
+		if(is_rooted)
+		{
+			full.assign(pc.m_current_dir, pc.m_current_dir + current_root_len);
+		}
+		else if(is_drive_relative)
+		{
+			full.assign(path, path + 2);
+			full.push_back(L'\\');
+		}
+		else
+		{
+			full.assign(pc.m_current_dir, pc.m_current_dir + pc.m_current_dir_len);
+			full.push_back(L'\\');
+		}
+		full.append(is_drive_relative ? path + 2 : path, path + path_len);
+	}
+	std::replace(full.begin(), full.end(), L'/', L'\\');
+	int const full_root_len = path_canonicalizer_root_len(full.c_str(), static_cast<int>(full.size()));
+	assert(full_root_len != 0);
+	path_canonicalizer_fold(full, full_root_len, out);
+	if(pc.m_real_name)
+	{
+		path_canonicalizer_correct_case(pc, full_root_len, out);
+	}
+	return true;
+}
+
+
+bool path_canonicalizer_is_separator(wchar_t const& ch)
+{
+	return ch == L'\\' || ch == L'/';
+}
+
+int path_canonicalizer_root_len(wchar_t const* const path, int const path_len)
+{
+	if(path_len >= 3 && path[1] == L':' && path_canonicalizer_is_separator(path[2]))
+	{
+		return 2;
+	}
+	if(path_len >= 2 && path_canonicalizer_is_separator(path[0]) && path_canonicalizer_is_separator(path[1]))
+	{
+		wchar_t const* const path_end = path + path_len;
+		wchar_t const* const server_end = std::find_if(path + 2, path_end, path_canonicalizer_is_separator);
+		if(server_end == path + 2 || server_end == path_end)
+		{
+			return 0;
+		}
+		wchar_t const* const share_end = std::find_if(server_end + 1, path_end, path_canonicalizer_is_separator);
+		if(share_end == server_end + 1)
+		{
+			return 0;
+		}
+		return static_cast<int>(share_end - path);
+	}
+	return 0;
+}
+
+void path_canonicalizer_fold(std::wstring const& path, int const root_len, std::wstring* const out)
+{
+	assert(out);
+	std::vector<std::pair<int, int>> components;
+	int const path_len = static_cast<int>(path.size());
+	int begin = root_len;
+	while(begin != path_len)
+	{
+		int const end = static_cast<int>(std::find(path.begin() + begin, path.end(), L'\\') - path.begin());
+		int const len = end - begin;
+		bool const is_dot = len == 1 && path[begin] == L'.';
+		bool const is_dot_dot = len == 2 && path[begin] == L'.' && path[begin + 1] == L'.';
+		if(is_dot_dot)
+		{
+			if(!components.empty())
+			{
+				components.pop_back();
+			}
+		}
+		else if(len != 0 && !is_dot)
+		{
+			components.emplace_back(begin, len);
+		}
+		begin = end == path_len ? end : end + 1;
+	}
+	out->assign(path.begin(), path.begin() + root_len);
+	if(root_len == 2 && (*out)[0] >= L'a' && (*out)[0] <= L'z')
+	{
+		(*out)[0] = L'A' + ((*out)[0] - L'a');
+	}
+	if(components.empty())
+	{
+		out->push_back(L'\\');
+		return;
+	}
+	for(auto const& component : components)
+	{
+		out->push_back(L'\\');
+		out->append(path.begin() + component.first, path.begin() + component.first + component.second);
+	}
+}
+
+void path_canonicalizer_correct_case(path_canonicalizer const& pc, int const root_len, std::wstring* const path)
+{
+	assert(pc.m_real_name);
+	assert(path);
+	std::wstring& p = *path;
+	std::wstring real_name;
+	int dir_len = root_len + 1;
+	int const path_len = static_cast<int>(p.size());
+	while(dir_len < path_len)
+	{
+		int const end = static_cast<int>(std::find(p.begin() + dir_len, p.end(), L'\\') - p.begin());
+		int const name_len = end - dir_len;
+		bool const found = pc.m_real_name(pc.m_param, p.c_str(), dir_len, p.c_str() + dir_len, name_len, &real_name);
+		if(!found || static_cast<int>(real_name.size()) != name_len)
+		{
+			return;
+		}
+		std::copy(real_name.begin(), real_name.end(), p.begin() + dir_len);
+		dir_len = end + 1;
+	}
+}
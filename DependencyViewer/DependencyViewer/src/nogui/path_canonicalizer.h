@@ -0,0 +1,20 @@
+#pragma once
+
+
+#include <string>
+
+
+typedef void* path_canonicalizer_param_t;
+typedef bool(*path_canonicalizer_real_name_t)(path_canonicalizer_param_t const param, wchar_t const* const dir, int const dir_len, wchar_t const* const name, int const name_len, std::wstring* const real_name_out);
+
+
+struct path_canonicalizer
+{
+	wchar_t const* m_current_dir;
+	int m_current_dir_len;
+	path_canonicalizer_real_name_t m_real_name;
+	path_canonicalizer_param_t m_param;
+};
+
+
+bool canonicalize_path(path_canonicalizer const& pc, wchar_t const* const path, int const path_len, std::wstring* const out);
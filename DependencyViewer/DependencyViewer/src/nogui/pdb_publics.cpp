@@ -0,0 +1,378 @@
+#include "pdb_publics.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "memory_mapped_file.h"
+
+#include "pe/coff_full.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+
+
+struct pdb_publics_super_block
+{
+	char m_magic[32];
+	std::uint32_t m_block_size;
+	std::uint32_t m_free_block_map_block;
+	std::uint32_t m_block_count;
+	std::uint32_t m_directory_size;
+	std::uint32_t m_unknown;
+	std::uint32_t m_directory_block_map_block;
+};
+static_assert(sizeof(pdb_publics_super_block) == 0x38, "");
+
+struct pdb_publics_info_header
+{
+	std::uint32_t m_version;
+	std::uint32_t m_signature;
+	std::uint32_t m_age;
+	std::uint8_t m_guid[16];
+};
+static_assert(sizeof(pdb_publics_info_header) == 0x1C, "");
+
+struct pdb_publics_dbi_header
+{
+	std::int32_t m_version_signature;
+	std::uint32_t m_version;
+	std::uint32_t m_age;
+	std::uint16_t m_global_stream;
+	std::uint16_t m_build_number;
+	std::uint16_t m_public_stream;
+	std::uint16_t m_pdb_dll_version;
+	std::uint16_t m_symbol_record_stream;
+	std::uint16_t m_pdb_dll_rebuild;
+	std::uint32_t m_module_info_size;
+	std::uint32_t m_section_contribution_size;
+	std::uint32_t m_section_map_size;
+	std::uint32_t m_source_info_size;
+	std::uint32_t m_type_server_map_size;
+	std::uint32_t m_mfc_type_server;
+	std::uint32_t m_optional_debug_header_size;
+	std::uint32_t m_ec_size;
+	std::uint16_t m_flags;
+	std::uint16_t m_machine;
+	std::uint32_t m_padding;
+};
+static_assert(sizeof(pdb_publics_dbi_header) == 0x40, "");
+
+struct pdb_publics_record_header
+{
+	std::uint16_t m_len;
+	std::uint16_t m_kind;
+};
+static_assert(sizeof(pdb_publics_record_header) == 0x4, "");
+
+struct pdb_publics_pub32
+{
+	std::uint32_t m_flags;
+	std::uint32_t m_offset;
+	std::uint16_t m_segment;
+};
+static_assert(sizeof(pdb_publics_pub32) == 0xC, "");
+static constexpr std::size_t const s_pdb_publics_pub32_size = 0xA;
+
+struct pdb_publics_omap_entry
+{
+	std::uint32_t m_rva;
+	std::uint32_t m_rva_to;
+};
+static_assert(sizeof(pdb_publics_omap_entry) == 0x8, "");
+
+struct pdb_publics_msf
+{
+	std::byte const* m_data;
+	std::uint32_t m_size;
+	std::uint32_t m_block_size;
+	std::vector<std::uint32_t> m_directory;
+	std::uint32_t m_stream_count;
+	std::vector<std::uint32_t> m_stream_blocks;
+};
+
+
+static constexpr char const s_pdb_publics_magic[] = "Microsoft C/C++ MSF 7.00\r\n\x1A" "DS\0\0";
+static_assert(sizeof(s_pdb_publics_magic) == 32, "");
+static constexpr std::uint32_t const s_pdb_publics_info_stream = 1;
+static constexpr std::uint32_t const s_pdb_publics_dbi_stream = 3;
+static constexpr std::uint32_t const s_pdb_publics_nil_stream_size = 0xFFFF'FFFFu;
+static constexpr std::uint16_t const s_pdb_publics_nil_stream = 0xFFFF;
+static constexpr int const s_pdb_publics_omap_from_src_debug_header = 4;
+static constexpr int const s_pdb_publics_section_headers_debug_header = 5;
+static constexpr int const s_pdb_publics_section_headers_orig_debug_header = 10;
+static constexpr std::uint16_t const s_pdb_publics_s_pub32 = 0x110E;
+
+
+static std::mutex g_pdb_publics_mutex;
+static std::unordered_map<std::string, std::unique_ptr<pdb_publics>>* g_pdb_publics = nullptr;
+
+
+static bool pdb_publics_msf_init(std::byte const* const data, int const size, pdb_publics_msf* const msf_out);
+static bool pdb_publics_msf_read_stream(pdb_publics_msf const& msf, std::uint32_t const stream, std::vector<std::byte>* const stream_out);
+static bool pdb_publics_omap_translate(std::vector<pdb_publics_omap_entry> const& omap, std::uint32_t const rva, std::uint32_t* const rva_out);
+static std::string pdb_publics_make_key(std::uint8_t const* const guid, std::uint32_t const age);
+
+
+pdb_publics::pdb_publics() noexcept :
+	m_names(),
+	m_publics()
+{
+}
+
+pdb_publics::~pdb_publics() noexcept
+{
+}
+
+bool pdb_publics::init(wchar_t const* const file_path, std::uint8_t const* const guid, std::uint32_t const age)
+{
+	assert(file_path);
+	assert(guid);
+	m_names.clear();
+	m_publics.clear();
+	memory_mapped_file const mmf{file_path};
+	WARN_M_R(mmf.begin(), L"Failed to map PDB file.", false);
+	pdb_publics_msf msf;
+	bool const msf_inited = pdb_publics_msf_init(mmf.begin(), mmf.size(), &msf);
+	WARN_M_R(msf_inited, L"Failed to pdb_publics_msf_init.", false);
+
+	std::vector<std::byte> info;
+	bool const info_read = pdb_publics_msf_read_stream(msf, s_pdb_publics_info_stream, &info);
+	WARN_M_R(info_read && info.size() >= sizeof(pdb_publics_info_header), L"Failed to read PDB info stream.", false);
+	pdb_publics_info_header const& info_hdr = *reinterpret_cast<pdb_publics_info_header const*>(info.data());
+	if(std::memcmp(info_hdr.m_guid, guid, sizeof(info_hdr.m_guid)) != 0)
+	{
+		return false;
+	}
+
+	std::vector<std::byte> dbi;
+	bool const dbi_read = pdb_publics_msf_read_stream(msf, s_pdb_publics_dbi_stream, &dbi);
+	WARN_M_R(dbi_read && dbi.size() >= sizeof(pdb_publics_dbi_header), L"Failed to read PDB DBI stream.", false);
+	pdb_publics_dbi_header const& dbi_hdr = *reinterpret_cast<pdb_publics_dbi_header const*>(dbi.data());
+	if(dbi_hdr.m_age != age)
+	{
+		return false;
+	}
+	std::uint64_t const dbg_hdr_offset = static_cast<std::uint64_t>(sizeof(pdb_publics_dbi_header)) + dbi_hdr.m_module_info_size + dbi_hdr.m_section_contribution_size + dbi_hdr.m_section_map_size + dbi_hdr.m_source_info_size + dbi_hdr.m_type_server_map_size + dbi_hdr.m_ec_size;
+	std::uint32_t const dbg_hdr_count = dbi_hdr.m_optional_debug_header_size / sizeof(std::uint16_t);
+	WARN_M_R(dbg_hdr_offset + dbg_hdr_count * sizeof(std::uint16_t) <= dbi.size(), L"PDB debug header out of bounds.", false);
+	auto const fn_debug_header_stream = [&](int const idx)
+	{
+		std::uint16_t stream = s_pdb_publics_nil_stream;
+		if(static_cast<std::uint32_t>(idx) < dbg_hdr_count)
+		{
+			std::memcpy(&stream, dbi.data() + dbg_hdr_offset + idx * sizeof(std::uint16_t), sizeof(stream));
+		}
+		return stream;
+	};
+
+	// Optimized images keep their publics in the pre-optimization layout, translate them through the OMAP.
+	std::vector<pdb_publics_omap_entry> omap_from_src;
+	std::uint16_t const omap_from_src_stream = fn_debug_header_stream(s_pdb_publics_omap_from_src_debug_header);
+	if(omap_from_src_stream != s_pdb_publics_nil_stream)
+	{
+		std::vector<std::byte> omap;
+		bool const omap_read = pdb_publics_msf_read_stream(msf, omap_from_src_stream, &omap);
+		WARN_M_R(omap_read, L"Failed to read PDB OMAP stream.", false);
+		omap_from_src.resize(omap.size() / sizeof(pdb_publics_omap_entry));
+		std::memcpy(omap_from_src.data(), omap.data(), omap_from_src.size() * sizeof(pdb_publics_omap_entry));
+		WARN_M_R(std::is_sorted(omap_from_src.begin(), omap_from_src.end(), [](pdb_publics_omap_entry const& a, pdb_publics_omap_entry const& b){ return a.m_rva < b.m_rva; }), L"PDB OMAP is not sorted.", false);
+	}
+	bool const has_omap = !omap_from_src.empty();
+	std::uint16_t const section_headers_stream = fn_debug_header_stream(has_omap ? s_pdb_publics_section_headers_orig_debug_header : s_pdb_publics_section_headers_debug_header);
+	WARN_M_R(section_headers_stream != s_pdb_publics_nil_stream && dbi_hdr.m_symbol_record_stream != s_pdb_publics_nil_stream, L"PDB has no publics.", false);
+
+	std::vector<std::byte> sections;
+	bool const sections_read = pdb_publics_msf_read_stream(msf, section_headers_stream, &sections);
+	WARN_M_R(sections_read, L"Failed to read PDB section headers stream.", false);
+	std::uint32_t const section_count = static_cast<std::uint32_t>(sections.size() / sizeof(pe_section_header));
+	pe_section_header const* const section_headers = reinterpret_cast<pe_section_header const*>(sections.data());
+
+	// Only the public names are kept, the record stream itself is dropped once they are copied out.
+	std::vector<std::byte> records;
+	bool const records_read = pdb_publics_msf_read_stream(msf, dbi_hdr.m_symbol_record_stream, &records);
+	WARN_M_R(records_read, L"Failed to read PDB symbol records stream.", false);
+	std::size_t pos = 0;
+	while(records.size() - pos >= sizeof(pdb_publics_record_header))
+	{
+		pdb_publics_record_header record_hdr;
+		std::memcpy(&record_hdr, records.data() + pos, sizeof(record_hdr));
+		std::size_t const record_size = sizeof(record_hdr.m_len) + record_hdr.m_len;
+		WARN_M_R(record_hdr.m_len >= sizeof(record_hdr.m_kind) && record_size <= records.size() - pos, L"PDB symbol record out of bounds.", false);
+		if(record_hdr.m_kind == s_pdb_publics_s_pub32 && record_size > sizeof(pdb_publics_record_header) + s_pdb_publics_pub32_size)
+		{
+			pdb_publics_pub32 pub;
+			std::memcpy(&pub, records.data() + pos + sizeof(pdb_publics_record_header), s_pdb_publics_pub32_size);
+			char const* const name = reinterpret_cast<char const*>(records.data() + pos + sizeof(pdb_publics_record_header) + s_pdb_publics_pub32_size);
+			char const* const name_end = reinterpret_cast<char const*>(records.data() + pos + record_size);
+			char const* const nul = std::find(name, name_end, '\0');
+			if(pub.m_segment != 0 && pub.m_segment <= section_count && nul != name_end && nul != name)
+			{
+				std::uint32_t rva = section_headers[pub.m_segment - 1].m_virtual_address + pub.m_offset;
+				if(!has_omap || pdb_publics_omap_translate(omap_from_src, rva, &rva))
+				{
+					m_publics.push_back(pdb_public{rva, static_cast<std::uint32_t>(m_names.size()), static_cast<std::uint32_t>(nul - name)});
+					m_names.insert(m_names.end(), name, nul + 1);
+				}
+			}
+		}
+		pos += record_size;
+	}
+	m_names.shrink_to_fit();
+	m_publics.shrink_to_fit();
+	std::stable_sort(m_publics.begin(), m_publics.end(), [](pdb_public const& a, pdb_public const& b){ return a.m_rva < b.m_rva; });
+	return true;
+}
+
+void pdb_publics::resolve(std::uint32_t const* const sorted_rvas, int const count, string* const names_out) const
+{
+	assert(std::is_sorted(sorted_rvas, sorted_rvas + count));
+	auto it = m_publics.begin();
+	for(int i = 0; i != count; ++i)
+	{
+		std::uint32_t const rva = sorted_rvas[i];
+		while(it != m_publics.end() && it->m_rva < rva)
+		{
+			++it;
+		}
+		names_out[i] = (it != m_publics.end() && it->m_rva == rva) ? string{m_names.data() + it->m_name, static_cast<int>(it->m_name_len)} : string{nullptr, 0};
+	}
+}
+
+int pdb_publics::get_count() const
+{
+	return static_cast<int>(m_publics.size());
+}
+
+
+void pdb_publics_cache::deinit()
+{
+	std::lock_guard<std::mutex> const lck(g_pdb_publics_mutex);
+	if(g_pdb_publics)
+	{
+		delete g_pdb_publics;
+		g_pdb_publics = nullptr;
+	}
+}
+
+pdb_publics const* pdb_publics_cache::get(std::uint8_t const* const guid, std::uint32_t const age, std::vector<std::wstring> const& candidate_paths)
+{
+	assert(guid);
+	std::string key = pdb_publics_make_key(guid, age);
+	std::lock_guard<std::mutex> const lck(g_pdb_publics_mutex);
+	if(!g_pdb_publics)
+	{
+		g_pdb_publics = new std::unordered_map<std::string, std::unique_ptr<pdb_publics>>();
+	}
+	auto const it = g_pdb_publics->find(key);
+	if(it != g_pdb_publics->end())
+	{
+		return it->second.get();
+	}
+	std::unique_ptr<pdb_publics> publics = std::make_unique<pdb_publics>();
+	auto const found = std::find_if(candidate_paths.begin(), candidate_paths.end(), [&](std::wstring const& e)
+	{
+		std::error_code ec;
+		return std::filesystem::is_regular_file(std::filesystem::path{e}, ec) && publics->init(e.c_str(), guid, age);
+	});
+	if(found == candidate_paths.end())
+	{
+		publics.reset();
+	}
+	return g_pdb_publics->emplace(std::move(key), std::move(publics)).first->second.get();
+}
+
+
+bool pdb_publics_msf_init(std::byte const* const data, int const size, pdb_publics_msf* const msf_out)
+{
+	assert(data);
+	assert(msf_out);
+	pdb_publics_msf& msf = *msf_out;
+	WARN_M_R(size >= static_cast<int>(sizeof(pdb_publics_super_block)), L"PDB is too small.", false);
+	pdb_publics_super_block const& sb = *reinterpret_cast<pdb_publics_super_block const*>(data);
+	WARN_M_R(std::memcmp(sb.m_magic, s_pdb_publics_magic, sizeof(sb.m_magic)) == 0, L"PDB has wrong signature.", false);
+	WARN_M_R(sb.m_block_size == 512 || sb.m_block_size == 1024 || sb.m_block_size == 2048 || sb.m_block_size == 4096, L"PDB has wrong block size.", false);
+	WARN_M_R(static_cast<std::uint64_t>(sb.m_block_count) * sb.m_block_size <= static_cast<std::uint64_t>(size), L"PDB is truncated.", false);
+	msf.m_data = data;
+	msf.m_size = sb.m_block_count * sb.m_block_size;
+	msf.m_block_size = sb.m_block_size;
+	std::uint32_t const dir_block_count = (sb.m_directory_size + sb.m_block_size - 1) / sb.m_block_size;
+	WARN_M_R(sb.m_directory_block_map_block < sb.m_block_count && dir_block_count <= sb.m_block_size / sizeof(std::uint32_t), L"PDB directory block map out of bounds.", false);
+	std::uint32_t const* const dir_blocks = reinterpret_cast<std::uint32_t const*>(data + static_cast<std::size_t>(sb.m_directory_block_map_block) * sb.m_block_size);
+	std::vector<std::uint32_t> directory(static_cast<std::size_t>(dir_block_count) * sb.m_block_size / sizeof(std::uint32_t));
+	for(std::uint32_t i = 0; i != dir_block_count; ++i)
+	{
+		WARN_M_R(dir_blocks[i] < sb.m_block_count, L"PDB directory block out of bounds.", false);
+		std::memcpy(reinterpret_cast<std::byte*>(directory.data()) + static_cast<std::size_t>(i) * sb.m_block_size, data + static_cast<std::size_t>(dir_blocks[i]) * sb.m_block_size, sb.m_block_size);
+	}
+	std::size_t const dir_count = sb.m_directory_size / sizeof(std::uint32_t);
+	WARN_M_R(dir_count >= 1 && directory[0] <= dir_count - 1, L"PDB directory is too small.", false);
+	msf.m_stream_count = directory[0];
+	msf.m_stream_blocks.resize(msf.m_stream_count);
+	std::size_t block_idx = 1 + msf.m_stream_count;
+	for(std::uint32_t i = 0; i != msf.m_stream_count; ++i)
+	{
+		std::uint32_t const stream_size = directory[1 + i];
+		std::size_t const stream_block_count = stream_size == s_pdb_publics_nil_stream_size ? 0 : (static_cast<std::size_t>(stream_size) + sb.m_block_size - 1) / sb.m_block_size;
+		WARN_M_R(stream_block_count <= dir_count - block_idx, L"PDB directory is too small.", false);
+		msf.m_stream_blocks[i] = static_cast<std::uint32_t>(block_idx);
+		block_idx += stream_block_count;
+	}
+	directory.resize(dir_count);
+	msf.m_directory.swap(directory);
+	return true;
+}
+
+bool pdb_publics_msf_read_stream(pdb_publics_msf const& msf, std::uint32_t const stream, std::vector<std::byte>* const stream_out)
+{
+	assert(stream_out);
+	WARN_M_R(stream < msf.m_stream_count, L"PDB stream out of bounds.", false);
+	std::uint32_t const stream_size = msf.m_directory[1 + stream];
+	std::vector<std::byte>& out = *stream_out;
+	if(stream_size == s_pdb_publics_nil_stream_size)
+	{
+		out.clear();
+		return true;
+	}
+	out.resize(stream_size);
+	std::uint32_t const* const blocks = msf.m_directory.data() + msf.m_stream_blocks[stream];
+	for(std::uint32_t done = 0, i = 0; done != stream_size; ++i)
+	{
+		std::uint32_t const block = blocks[i];
+		WARN_M_R(block < msf.m_size / msf.m_block_size, L"PDB stream block out of bounds.", false);
+		std::uint32_t const chunk = (std::min)(msf.m_block_size, stream_size - done);
+		std::memcpy(out.data() + done, msf.m_data + static_cast<std::size_t>(block) * msf.m_block_size, chunk);
+		done += chunk;
+	}
+	return true;
+}
+
+bool pdb_publics_omap_translate(std::vector<pdb_publics_omap_entry> const& omap, std::uint32_t const rva, std::uint32_t* const rva_out)
+{
+	assert(rva_out);
+	auto const it = std::upper_bound(omap.begin(), omap.end(), rva, [](std::uint32_t const& v, pdb_publics_omap_entry const& e){ return v < e.m_rva; });
+	if(it == omap.begin())
+	{
+		return false;
+	}
+	pdb_publics_omap_entry const& entry = *std::prev(it);
+	if(entry.m_rva_to == 0)
+	{
+		return false;
+	}
+	*rva_out = entry.m_rva_to + (rva - entry.m_rva);
+	return true;
+}
+
+std::string pdb_publics_make_key(std::uint8_t const* const guid, std::uint32_t const age)
+{
+	std::string key(16 + sizeof(age), '\0');
+	std::memcpy(key.data(), guid, 16);
+	std::memcpy(key.data() + 16, &age, sizeof(age));
+	return key;
+}
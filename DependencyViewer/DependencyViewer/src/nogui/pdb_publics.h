@@ -0,0 +1,41 @@
+#pragma once
+
+
+#include "my_string.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+struct pdb_public
+{
+	std::uint32_t m_rva;
+	std::uint32_t m_name;
+	std::uint32_t m_name_len;
+};
+
+
+class pdb_publics
+{
+public:
+	pdb_publics() noexcept;
+	pdb_publics(pdb_publics const&) = delete;
+	pdb_publics& operator=(pdb_publics const&) = delete;
+	~pdb_publics() noexcept;
+public:
+	bool init(wchar_t const* const file_path, std::uint8_t const* const guid, std::uint32_t const age);
+	void resolve(std::uint32_t const* const sorted_rvas, int const count, string* const names_out) const;
+	int get_count() const;
+private:
+	std::vector<char> m_names;
+	std::vector<pdb_public> m_publics;
+};
+
+
+namespace pdb_publics_cache
+{
+	void deinit();
+	pdb_publics const* get(std::uint8_t const* const guid, std::uint32_t const age, std::vector<std::wstring> const& candidate_paths);
+}
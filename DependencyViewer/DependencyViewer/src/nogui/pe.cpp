@@ -1 +1 @@
-#include "pe.h"
+#include "pe.h"
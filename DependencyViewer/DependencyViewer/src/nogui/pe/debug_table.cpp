@@ -0,0 +1,71 @@
+#include "debug_table.h"
+
+#include "coff_full.h"
+#include "mz.h"
+
+#include "../assert_my.h"
+#include "../cassert_my.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+static constexpr std::uint32_t const s_pe_debug_type_codeview = 2;
+static constexpr std::uint32_t const s_pe_codeview_signature_rsds = 0x5344'5352;
+
+
+bool pe_parse_debug_pdb_info(std::byte const* const file_data, int const file_size, pe_pdb_info* const pdb_info_out)
+{
+	assert(file_data);
+	assert(pdb_info_out);
+	pe_pdb_info& pdb_info = *pdb_info_out;
+	pdb_info.m_pdb_path = pe_string{nullptr, 0};
+	pe_coff_full_32_64 const* coff_hdr;
+	bool const coff_parsed = pe_parse_coff_full_32_64(file_data, file_size, &coff_hdr);
+	WARN_M_R(coff_parsed, L"Failed to pe_parse_coff_full_32_64.", false);
+	pe_dos_header const& dos_hdr = *reinterpret_cast<pe_dos_header const*>(file_data + 0);
+	bool const is_32 = pe_is_32_bit(coff_hdr->m_32.m_standard);
+	std::uint32_t const dir_tbl_cnt = is_32 ? coff_hdr->m_32.m_windows.m_data_directory_count : coff_hdr->m_64.m_windows.m_data_directory_count;
+	if(!(static_cast<int>(pe_e_directory_table::debug) < dir_tbl_cnt))
+	{
+		return true;
+	}
+	pe_data_directory const* const dir_tbl = reinterpret_cast<pe_data_directory const*>(file_data + dos_hdr.m_pe_offset + (is_32 ? sizeof(pe_coff_full_32) : sizeof(pe_coff_full_64)));
+	pe_data_directory const& dbg_dir = dir_tbl[static_cast<int>(pe_e_directory_table::debug)];
+	if(dbg_dir.m_va == 0 || dbg_dir.m_size == 0)
+	{
+		return true;
+	}
+	pe_section_header const* sct;
+	std::uint32_t const dbg_dir_raw = pe_find_object_in_raw(file_data, dbg_dir.m_va, dbg_dir.m_size, sct);
+	WARN_M_R(dbg_dir_raw != 0, L"Debug directory not found in any section.", false);
+	WARN_M_R(dbg_dir_raw <= static_cast<std::uint32_t>(file_size) && dbg_dir.m_size <= static_cast<std::uint32_t>(file_size) - dbg_dir_raw, L"Debug directory is out of file.", false);
+	pe_debug_directory const* const entries = reinterpret_cast<pe_debug_directory const*>(file_data + dbg_dir_raw);
+	std::uint32_t const n = dbg_dir.m_size / sizeof(pe_debug_directory);
+	for(std::uint32_t i = 0; i != n; ++i)
+	{
+		pe_debug_directory const& entry = entries[i];
+		if(entry.m_type != s_pe_debug_type_codeview || entry.m_data_size < sizeof(pe_codeview_pdb70) + 1)
+		{
+			continue;
+		}
+		if(entry.m_data_raw > static_cast<std::uint32_t>(file_size) || entry.m_data_size > static_cast<std::uint32_t>(file_size) - entry.m_data_raw)
+		{
+			continue;
+		}
+		pe_codeview_pdb70 const& cv = *reinterpret_cast<pe_codeview_pdb70 const*>(file_data + entry.m_data_raw);
+		if(cv.m_signature != s_pe_codeview_signature_rsds)
+		{
+			continue;
+		}
+		char const* const path = reinterpret_cast<char const*>(file_data + entry.m_data_raw + sizeof(pe_codeview_pdb70));
+		char const* const path_end = path + (entry.m_data_size - sizeof(pe_codeview_pdb70));
+		char const* const nul = std::find(path, path_end, '\0');
+		WARN_M_R(nul != path_end && nul != path, L"CodeView PDB path is not terminated.", false);
+		std::memcpy(pdb_info.m_guid, cv.m_guid, sizeof(cv.m_guid));
+		pdb_info.m_age = cv.m_age;
+		pdb_info.m_pdb_path = pe_string{path, static_cast<int>(nul - path)};
+		return true;
+	}
+	return true;
+}
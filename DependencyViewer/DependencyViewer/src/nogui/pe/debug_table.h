@@ -0,0 +1,41 @@
+#pragma once
+
+
+#include "pe_util.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+struct pe_debug_directory
+{
+	std::uint32_t m_characteristics;
+	std::uint32_t m_time_date_stamp;
+	std::uint16_t m_major_version;
+	std::uint16_t m_minor_version;
+	std::uint32_t m_type;
+	std::uint32_t m_data_size;
+	std::uint32_t m_data_rva;
+	std::uint32_t m_data_raw;
+};
+static_assert(sizeof(pe_debug_directory) == 28, "");
+static_assert(sizeof(pe_debug_directory) == 0x1C, "");
+
+struct pe_codeview_pdb70
+{
+	std::uint32_t m_signature;
+	std::uint8_t m_guid[16];
+	std::uint32_t m_age;
+};
+static_assert(sizeof(pe_codeview_pdb70) == 24, "");
+static_assert(sizeof(pe_codeview_pdb70) == 0x18, "");
+
+struct pe_pdb_info
+{
+	std::uint8_t m_guid[16];
+	std::uint32_t m_age;
+	pe_string m_pdb_path;
+};
+
+
+bool pe_parse_debug_pdb_info(std::byte const* const file_data, int const file_size, pe_pdb_info* const pdb_info_out);
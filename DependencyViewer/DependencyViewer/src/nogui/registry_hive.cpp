@@ -0,0 +1,292 @@
+#include "registry_hive.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+
+struct registry_hive_base_block
+{
+	char m_signature[4];
+	std::uint32_t m_primary_sequence;
+	std::uint32_t m_secondary_sequence;
+	std::uint32_t m_last_written[2];
+	std::uint32_t m_major_version;
+	std::uint32_t m_minor_version;
+	std::uint32_t m_file_type;
+	std::uint32_t m_file_format;
+	std::uint32_t m_root_cell;
+	std::uint32_t m_hive_bins_size;
+};
+static_assert(sizeof(registry_hive_base_block) == 0x2C, "");
+
+struct registry_hive_nk
+{
+	char m_signature[2];
+	std::uint16_t m_flags;
+	std::uint32_t m_last_written[2];
+	std::uint32_t m_access_bits;
+	std::uint32_t m_parent;
+	std::uint32_t m_sub_key_count;
+	std::uint32_t m_volatile_sub_key_count;
+	std::uint32_t m_sub_keys_list;
+	std::uint32_t m_volatile_sub_keys_list;
+	std::uint32_t m_value_count;
+	std::uint32_t m_values_list;
+	std::uint32_t m_security;
+	std::uint32_t m_class_name;
+	std::uint32_t m_max_sub_key_name_len;
+	std::uint32_t m_max_sub_key_class_len;
+	std::uint32_t m_max_value_name_len;
+	std::uint32_t m_max_value_data_len;
+	std::uint32_t m_work_var;
+	std::uint16_t m_name_len;
+	std::uint16_t m_class_name_len;
+};
+static_assert(sizeof(registry_hive_nk) == 0x4C, "");
+
+struct registry_hive_vk
+{
+	char m_signature[2];
+	std::uint16_t m_name_len;
+	std::uint32_t m_data_size;
+	std::uint32_t m_data;
+	std::uint32_t m_type;
+	std::uint16_t m_flags;
+	std::uint16_t m_spare;
+};
+static_assert(sizeof(registry_hive_vk) == 0x14, "");
+
+struct registry_hive_list
+{
+	char m_signature[2];
+	std::uint16_t m_count;
+};
+static_assert(sizeof(registry_hive_list) == 0x4, "");
+
+
+static constexpr std::uint32_t const s_registry_hive_bins_offset = 0x1000;
+static constexpr std::uint16_t const s_registry_hive_key_comp_name = 0x0020;
+static constexpr std::uint16_t const s_registry_hive_value_comp_name = 0x0001;
+static constexpr std::uint32_t const s_registry_hive_data_inline = 0x8000'0000u;
+static constexpr std::uint32_t const s_registry_hive_reg_sz = 1;
+static constexpr std::uint32_t const s_registry_hive_reg_expand_sz = 2;
+static constexpr std::uint32_t const s_registry_hive_reg_dword = 4;
+
+
+static bool registry_hive_name_equals(std::byte const* const name, int const name_len, bool const is_compressed, std::string_view const other);
+
+
+registry_hive::registry_hive() noexcept :
+	m_data(),
+	m_root_key()
+{
+}
+
+registry_hive::~registry_hive() noexcept
+{
+}
+
+bool registry_hive::init(wchar_t const* const file_path)
+{
+	assert(file_path);
+	std::ifstream file{std::filesystem::path{file_path}, std::ios::in | std::ios::binary | std::ios::ate};
+	WARN_M_R(file.is_open(), L"Failed to open registry hive.", false);
+	std::streamoff const size = file.tellg();
+	WARN_M_R(size >= s_registry_hive_bins_offset && size <= 0x7FFF'FFFF, L"Registry hive has wrong size.", false);
+	m_data.resize(static_cast<std::size_t>(size));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(m_data.data()), size);
+	WARN_M_R(file.good(), L"Failed to read registry hive.", false);
+	registry_hive_base_block const& base = *reinterpret_cast<registry_hive_base_block const*>(m_data.data());
+	WARN_M_R(std::memcmp(base.m_signature, "regf", 4) == 0, L"Registry hive has wrong signature.", false);
+	// Dirty hives are read as they are, transaction logs are not replayed.
+	WARN_M(base.m_primary_sequence == base.m_secondary_sequence, L"Registry hive is dirty.");
+	registry_hive_nk const* const root = reinterpret_cast<registry_hive_nk const*>(get_cell(base.m_root_cell, sizeof(registry_hive_nk)));
+	WARN_M_R(root && std::memcmp(root->m_signature, "nk", 2) == 0, L"Registry hive has bad root key.", false);
+	m_root_key = base.m_root_cell;
+	return true;
+}
+
+std::uint32_t registry_hive::get_root_key() const
+{
+	return m_root_key;
+}
+
+std::uint32_t registry_hive::find_key(std::uint32_t const key, std::string_view const path) const
+{
+	std::uint32_t curr = key;
+	std::size_t pos = 0;
+	while(curr != 0 && pos < path.size())
+	{
+		std::size_t const sep = std::min(path.find('\\', pos), path.size());
+		curr = find_sub_key(curr, path.substr(pos, sep - pos));
+		pos = sep + 1;
+	}
+	return curr;
+}
+
+bool registry_hive::get_values(std::uint32_t const key, std::vector<registry_hive_value>* const values_out) const
+{
+	assert(values_out);
+	values_out->clear();
+	registry_hive_nk const* const nk = reinterpret_cast<registry_hive_nk const*>(get_cell(key, sizeof(registry_hive_nk)));
+	WARN_M_R(nk && std::memcmp(nk->m_signature, "nk", 2) == 0, L"Bad registry key.", false);
+	if(nk->m_value_count == 0)
+	{
+		return true;
+	}
+	WARN_M_R(nk->m_value_count <= 0xFFFF, L"Too many registry values.", false);
+	std::uint32_t const* const list = reinterpret_cast<std::uint32_t const*>(get_cell(nk->m_values_list, nk->m_value_count * sizeof(std::uint32_t)));
+	WARN_M_R(list, L"Bad registry values list.", false);
+	for(std::uint32_t i = 0; i != nk->m_value_count; ++i)
+	{
+		registry_hive_vk const* const vk = reinterpret_cast<registry_hive_vk const*>(get_cell(list[i], sizeof(registry_hive_vk)));
+		if(!vk || std::memcmp(vk->m_signature, "vk", 2) != 0 || !get_cell(list[i], sizeof(registry_hive_vk) + vk->m_name_len))
+		{
+			continue;
+		}
+		registry_hive_value value;
+		std::byte const* const name = reinterpret_cast<std::byte const*>(vk + 1);
+		if((vk->m_flags & s_registry_hive_value_comp_name) != 0)
+		{
+			value.m_name.assign(reinterpret_cast<char const*>(name), vk->m_name_len);
+		}
+		else
+		{
+			value.m_name.resize(vk->m_name_len / 2);
+			for(int j = 0; j != vk->m_name_len / 2; ++j)
+			{
+				value.m_name[j] = static_cast<char>(name[j * 2]);
+			}
+		}
+		value.m_type = vk->m_type;
+		value.m_dword = 0;
+		bool const is_inline = (vk->m_data_size & s_registry_hive_data_inline) != 0;
+		std::uint32_t const data_size = vk->m_data_size & ~s_registry_hive_data_inline;
+		std::byte const* const data = is_inline ? reinterpret_cast<std::byte const*>(&vk->m_data) : get_cell(vk->m_data, data_size);
+		// Big data (db) cells are not followed, nothing we read is that large.
+		if(!data || (is_inline && data_size > 4) || data_size > 16 * 1024)
+		{
+			continue;
+		}
+		if(value.m_type == s_registry_hive_reg_dword && data_size >= 4)
+		{
+			std::memcpy(&value.m_dword, data, sizeof(value.m_dword));
+		}
+		else if(value.m_type == s_registry_hive_reg_sz || value.m_type == s_registry_hive_reg_expand_sz)
+		{
+			value.m_string.resize(data_size / 2);
+			for(std::uint32_t j = 0; j != data_size / 2; ++j)
+			{
+				std::uint16_t ch;
+				std::memcpy(&ch, data + j * 2, sizeof(ch));
+				value.m_string[j] = static_cast<wchar_t>(ch);
+			}
+			value.m_string.erase(std::find(value.m_string.begin(), value.m_string.end(), L'\0'), value.m_string.end());
+		}
+		values_out->push_back(std::move(value));
+	}
+	return true;
+}
+
+std::byte const* registry_hive::get_cell(std::uint32_t const offset, std::uint32_t const min_size) const
+{
+	std::uint64_t const cell = static_cast<std::uint64_t>(s_registry_hive_bins_offset) + offset;
+	if(offset == 0xFFFF'FFFFu || cell + sizeof(std::int32_t) > m_data.size())
+	{
+		return nullptr;
+	}
+	std::int32_t size;
+	std::memcpy(&size, m_data.data() + cell, sizeof(size));
+	if(size >= 0 || static_cast<std::uint64_t>(-static_cast<std::int64_t>(size)) < sizeof(std::int32_t) + static_cast<std::uint64_t>(min_size) || cell + sizeof(std::int32_t) + min_size > m_data.size())
+	{
+		return nullptr;
+	}
+	return m_data.data() + cell + sizeof(std::int32_t);
+}
+
+std::uint32_t registry_hive::find_sub_key(std::uint32_t const key, std::string_view const name) const
+{
+	registry_hive_nk const* const nk = reinterpret_cast<registry_hive_nk const*>(get_cell(key, sizeof(registry_hive_nk)));
+	if(!nk || std::memcmp(nk->m_signature, "nk", 2) != 0 || nk->m_sub_key_count == 0)
+	{
+		return 0;
+	}
+	return find_in_list(nk->m_sub_keys_list, name, 0);
+}
+
+std::uint32_t registry_hive::find_in_list(std::uint32_t const list, std::string_view const name, int const depth) const
+{
+	registry_hive_list const* const hdr = reinterpret_cast<registry_hive_list const*>(get_cell(list, sizeof(registry_hive_list)));
+	if(!hdr || depth > 1)
+	{
+		return 0;
+	}
+	bool const is_li = std::memcmp(hdr->m_signature, "li", 2) == 0;
+	bool const is_ri = std::memcmp(hdr->m_signature, "ri", 2) == 0;
+	bool const is_lf = std::memcmp(hdr->m_signature, "lf", 2) == 0 || std::memcmp(hdr->m_signature, "lh", 2) == 0;
+	if(!is_li && !is_ri && !is_lf)
+	{
+		return 0;
+	}
+	std::uint32_t const stride = is_lf ? 2 : 1;
+	std::byte const* const cell = get_cell(list, sizeof(registry_hive_list) + hdr->m_count * stride * sizeof(std::uint32_t));
+	if(!cell)
+	{
+		return 0;
+	}
+	std::uint32_t const* const entries = reinterpret_cast<std::uint32_t const*>(cell + sizeof(registry_hive_list));
+	for(std::uint32_t i = 0; i != hdr->m_count; ++i)
+	{
+		std::uint32_t const entry = entries[i * stride];
+		if(is_ri)
+		{
+			std::uint32_t const found = find_in_list(entry, name, depth + 1);
+			if(found != 0)
+			{
+				return found;
+			}
+		}
+		else if(key_name_equals(entry, name))
+		{
+			return entry;
+		}
+	}
+	return 0;
+}
+
+bool registry_hive::key_name_equals(std::uint32_t const key, std::string_view const name) const
+{
+	registry_hive_nk const* const nk = reinterpret_cast<registry_hive_nk const*>(get_cell(key, sizeof(registry_hive_nk)));
+	if(!nk || std::memcmp(nk->m_signature, "nk", 2) != 0 || !get_cell(key, sizeof(registry_hive_nk) + nk->m_name_len))
+	{
+		return false;
+	}
+	return registry_hive_name_equals(reinterpret_cast<std::byte const*>(nk + 1), nk->m_name_len, (nk->m_flags & s_registry_hive_key_comp_name) != 0, name);
+}
+
+
+bool registry_hive_name_equals(std::byte const* const name, int const name_len, bool const is_compressed, std::string_view const other)
+{
+	int const char_size = is_compressed ? 1 : 2;
+	if(name_len != static_cast<int>(other.size()) * char_size)
+	{
+		return false;
+	}
+	for(int i = 0; i != static_cast<int>(other.size()); ++i)
+	{
+		char const ch = static_cast<char>(name[i * char_size]);
+		bool const is_high_zero = is_compressed || name[i * char_size + 1] == std::byte{0};
+		if(!is_high_zero || to_lowercase(ch) != to_lowercase(other[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+struct registry_hive_value
+{
+	std::string m_name;
+	std::uint32_t m_type;
+	std::uint32_t m_dword;
+	std::wstring m_string;
+};
+
+
+class registry_hive
+{
+public:
+	registry_hive() noexcept;
+	registry_hive(registry_hive const&) = delete;
+	registry_hive& operator=(registry_hive const&) = delete;
+	~registry_hive() noexcept;
+public:
+	bool init(wchar_t const* const file_path);
+	std::uint32_t get_root_key() const;
+	std::uint32_t find_key(std::uint32_t const key, std::string_view const path) const;
+	bool get_values(std::uint32_t const key, std::vector<registry_hive_value>* const values_out) const;
+private:
+	std::byte const* get_cell(std::uint32_t const offset, std::uint32_t const min_size) const;
+	std::uint32_t find_sub_key(std::uint32_t const key, std::string_view const name) const;
+	std::uint32_t find_in_list(std::uint32_t const list, std::string_view const name, int const depth) const;
+	bool key_name_equals(std::uint32_t const key, std::string_view const name) const;
+private:
+	std::vector<std::byte> m_data;
+	std::uint32_t m_root_key;
+};
@@ -0,0 +1,80 @@
+#include "search_plan.h"
+
+#include "api_set.h"
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "dependency_locator.h"
+#include "known_dlls.h"
+
+#include <algorithm>
+
+#include "my_windows.h"
+
+
+bool make_native_search_plan(search_plan* const plan_out)
+{
+	assert(plan_out);
+	search_plan& plan = *plan_out;
+	plan.m_sxs = &locate_dependency_sxs_native;
+	plan.m_sxs_catalog = nullptr;
+	plan.m_api_set = nullptr;
+	plan.m_known_dlls_path = known_dlls::get_path();
+	auto const& known_dll_names = known_dlls::get_names_sorted_lowercase_ascii();
+	plan.m_known_dlls.clear();
+	plan.m_known_dlls.reserve(known_dll_names.size());
+	plan.m_known_dlls.insert(known_dll_names.begin(), known_dll_names.end());
+
+	UINT const sys_len = GetSystemDirectoryW(nullptr, 0);
+	WARN_M_R(sys_len != 0, L"Failed to GetSystemDirectoryW.", false);
+	plan.m_system32.resize(sys_len);
+	UINT const got_sys = GetSystemDirectoryW(plan.m_system32.data(), sys_len);
+	WARN_M_R(got_sys != 0 && got_sys < sys_len, L"Failed to GetSystemDirectoryW.", false);
+	plan.m_system32.resize(got_sys);
+	plan.m_api_set = api_set_schemas::get(plan.m_system32);
+
+	UINT const win_len = GetWindowsDirectoryW(nullptr, 0);
+	WARN_M_R(win_len != 0, L"Failed to GetWindowsDirectoryW.", false);
+	plan.m_windows.resize(win_len);
+	UINT const got_win = GetWindowsDirectoryW(plan.m_windows.data(), win_len);
+	WARN_M_R(got_win != 0 && got_win < win_len, L"Failed to GetWindowsDirectoryW.", false);
+	plan.m_windows.resize(got_win);
+
+	DWORD const currdir_len = GetCurrentDirectoryW(0, nullptr);
+	WARN_M_R(currdir_len != 0, L"Failed to GetCurrentDirectoryW.", false);
+	plan.m_current_dir.resize(currdir_len);
+	DWORD const got_currdir = GetCurrentDirectoryW(currdir_len, plan.m_current_dir.data());
+	WARN_M_R(got_currdir != 0 && got_currdir < currdir_len, L"Failed to GetCurrentDirectoryW.", false);
+	plan.m_current_dir.resize(got_currdir);
+
+	plan.m_path_dirs.clear();
+	DWORD const env_len = GetEnvironmentVariableW(L"PATH", nullptr, 0);
+	if(env_len != 0)
+	{
+		std::wstring env(env_len, L'\0');
+		DWORD const got_env = GetEnvironmentVariableW(L"PATH", env.data(), env_len);
+		WARN_M_R(got_env < env_len, L"Failed to GetEnvironmentVariableW.", false);
+		env.resize(got_env);
+		auto start = env.cbegin();
+		for(;;)
+		{
+			auto const it = std::find(start, env.cend(), L';');
+			plan.m_path_dirs.emplace_back(start, it);
+			if(it == env.cend())
+			{
+				break;
+			}
+			start = it + 1;
+		}
+	}
+
+	plan.m_fs = get_native_file_system();
+	return true;
+}
+
+void search_plan_use_sxs_catalog(search_plan* const plan_in_out, sxs_catalog* const catalog)
+{
+	assert(plan_in_out);
+	assert(catalog);
+	plan_in_out->m_sxs = &locate_dependency_sxs_offline;
+	plan_in_out->m_sxs_catalog = catalog;
+}
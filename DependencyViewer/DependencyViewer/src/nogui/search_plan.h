@@ -0,0 +1,35 @@
+#pragma once
+
+
+#include "file_system.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+
+class api_set_schema;
+struct dependency_locator;
+class sxs_catalog;
+
+
+typedef bool(*search_plan_sxs_t)(dependency_locator& self);
+
+
+struct search_plan
+{
+	search_plan_sxs_t m_sxs;
+	sxs_catalog* m_sxs_catalog;
+	api_set_schema const* m_api_set;
+	std::wstring m_known_dlls_path;
+	std::unordered_set<std::string> m_known_dlls;
+	std::wstring m_system32;
+	std::wstring m_windows;
+	std::wstring m_current_dir;
+	std::vector<std::wstring> m_path_dirs;
+	file_system m_fs;
+};
+
+
+bool make_native_search_plan(search_plan* const plan_out);
+void search_plan_use_sxs_catalog(search_plan* const plan_in_out, sxs_catalog* const catalog);
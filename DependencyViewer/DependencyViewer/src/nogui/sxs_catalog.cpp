@@ -0,0 +1,192 @@
+#include "sxs_catalog.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <system_error>
+#include <tuple>
+
+
+static bool sxs_catalog_parse_dir_name(std::wstring const& dir_name, sxs_catalog_entry* const entry_out);
+static std::string const& sxs_catalog_normalize_token(std::string const& token);
+static std::string const& sxs_catalog_normalize_language(std::string const& language);
+static std::tuple<std::string const&, std::string const&, std::string const&, std::string const&> sxs_catalog_tie(sxs_catalog_entry const& entry);
+
+
+sxs_catalog::sxs_catalog() noexcept :
+	m_entries(),
+	m_mutex(),
+	m_cache(),
+	m_hits(0),
+	m_misses(0)
+{
+}
+
+sxs_catalog::~sxs_catalog() noexcept
+{
+}
+
+bool sxs_catalog::init(std::wstring const& winsxs_dir)
+{
+	m_entries.clear();
+	m_cache.clear();
+	std::error_code ec;
+	std::filesystem::directory_iterator it{winsxs_dir, ec};
+	WARN_M_R(!ec, L"Failed to enumerate WinSxS directory.", false);
+	for(; it != std::filesystem::directory_iterator{}; it.increment(ec))
+	{
+		WARN_M_R(!ec, L"Failed to enumerate WinSxS directory.", false);
+		if(!it->is_directory(ec))
+		{
+			continue;
+		}
+		sxs_catalog_entry entry;
+		if(!sxs_catalog_parse_dir_name(it->path().filename().wstring(), &entry))
+		{
+			continue;
+		}
+		entry.m_dir = it->path().wstring();
+		m_entries.push_back(std::move(entry));
+	}
+	std::sort(m_entries.begin(), m_entries.end(), [](sxs_catalog_entry const& a, sxs_catalog_entry const& b){ return std::tuple_cat(sxs_catalog_tie(a), std::tie(a.m_version)) < std::tuple_cat(sxs_catalog_tie(b), std::tie(b.m_version)); });
+	return true;
+}
+
+std::wstring const* sxs_catalog::resolve(sxs_assembly_identity const& identity, bool const is_32_bit)
+{
+	std::string key;
+	key.append(identity.m_name).append(1, '|').append(identity.m_arch).append(1, '|').append(identity.m_token).append(1, '|').append(identity.m_language).append(1, '|').append(std::to_string(identity.m_version)).append(1, is_32_bit ? '1' : '0');
+	{
+		std::lock_guard<std::mutex> const lck(m_mutex);
+		auto const it = m_cache.find(key);
+		if(it != m_cache.end())
+		{
+			++m_hits;
+			return it->second ? &it->second->m_dir : nullptr;
+		}
+	}
+	static std::string const s_x86 = "x86";
+	static std::string const s_wow64 = "wow64";
+	static std::string const s_amd64 = "amd64";
+	bool const is_any = identity.m_arch.empty() || identity.m_arch == "*";
+	std::array<std::string const*, 2> const archs =
+	{
+		is_any ? (is_32_bit ? &s_x86 : &s_amd64) : &identity.m_arch,
+		(is_any && is_32_bit) || identity.m_arch == s_x86 ? &s_wow64 : nullptr,
+	};
+	sxs_catalog_entry const* found = nullptr;
+	for(std::string const* const arch : archs)
+	{
+		if(arch && !found)
+		{
+			found = find(identity, *arch);
+		}
+	}
+	std::lock_guard<std::mutex> const lck(m_mutex);
+	m_cache.emplace(std::move(key), found);
+	++m_misses;
+	return found ? &found->m_dir : nullptr;
+}
+
+int sxs_catalog::get_count() const
+{
+	return static_cast<int>(m_entries.size());
+}
+
+int sxs_catalog::get_hits() const
+{
+	return m_hits.load();
+}
+
+int sxs_catalog::get_misses() const
+{
+	return m_misses.load();
+}
+
+sxs_catalog_entry const* sxs_catalog::find(sxs_assembly_identity const& identity, std::string const& arch) const
+{
+	sxs_catalog_entry key;
+	key.m_arch = arch;
+	key.m_name = identity.m_name;
+	key.m_token = sxs_catalog_normalize_token(identity.m_token);
+	key.m_language = sxs_catalog_normalize_language(identity.m_language);
+	auto const range = std::equal_range(m_entries.begin(), m_entries.end(), key, [](sxs_catalog_entry const& a, sxs_catalog_entry const& b){ return sxs_catalog_tie(a) < sxs_catalog_tie(b); });
+	if(range.first == range.second)
+	{
+		return nullptr;
+	}
+	auto const exact = std::find_if(range.first, range.second, [&](sxs_catalog_entry const& e){ return e.m_version == identity.m_version; });
+	if(exact != range.second)
+	{
+		return &*exact;
+	}
+	// No publisher policy is evaluated, the newest servicing release of the same major.minor stands in for it.
+	auto const serviced = std::find_if(std::make_reverse_iterator(range.second), std::make_reverse_iterator(range.first), [&](sxs_catalog_entry const& e){ return (e.m_version >> 32) == (identity.m_version >> 32); });
+	if(serviced != std::make_reverse_iterator(range.first) && serviced->m_version > identity.m_version)
+	{
+		return &*serviced;
+	}
+	return nullptr;
+}
+
+
+bool sxs_catalog_parse_dir_name(std::wstring const& dir_name, sxs_catalog_entry* const entry_out)
+{
+	assert(entry_out);
+	if(!is_ascii(dir_name.c_str(), static_cast<int>(dir_name.size())))
+	{
+		return false;
+	}
+	std::string name(dir_name.size(), '\0');
+	std::transform(dir_name.begin(), dir_name.end(), name.begin(), [](wchar_t const& ch){ return static_cast<char>(to_lowercase(ch)); });
+	// arch_name_token_version_language_hash, the name itself may contain underscores.
+	std::array<std::size_t, 4> seps;
+	std::size_t end = name.size();
+	for(std::size_t& sep : seps)
+	{
+		sep = end == 0 ? std::string::npos : name.rfind('_', end - 1);
+		if(sep == std::string::npos)
+		{
+			return false;
+		}
+		end = sep;
+	}
+	std::size_t const arch_end = name.find('_');
+	if(arch_end >= seps[3])
+	{
+		return false;
+	}
+	std::string const version = name.substr(seps[2] + 1, seps[1] - seps[2] - 1);
+	if(!sxs_parse_version(version.c_str(), static_cast<int>(version.size()), &entry_out->m_version))
+	{
+		return false;
+	}
+	entry_out->m_arch = name.substr(0, arch_end);
+	entry_out->m_name = name.substr(arch_end + 1, seps[3] - arch_end - 1);
+	entry_out->m_token = name.substr(seps[3] + 1, seps[2] - seps[3] - 1);
+	std::string const language = name.substr(seps[1] + 1, seps[0] - seps[1] - 1);
+	entry_out->m_language = sxs_catalog_normalize_language(language);
+	return true;
+}
+
+std::string const& sxs_catalog_normalize_token(std::string const& token)
+{
+	static std::string const s_none = "none";
+	return token.empty() ? s_none : token;
+}
+
+std::string const& sxs_catalog_normalize_language(std::string const& language)
+{
+	static std::string const s_none = "none";
+	bool const is_neutral = language.empty() || language == "*" || language == "neutral" || language == "x-ww";
+	return is_neutral ? s_none : language;
+}
+
+std::tuple<std::string const&, std::string const&, std::string const&, std::string const&> sxs_catalog_tie(sxs_catalog_entry const& entry)
+{
+	return std::tie(entry.m_name, entry.m_arch, entry.m_token, entry.m_language);
+}
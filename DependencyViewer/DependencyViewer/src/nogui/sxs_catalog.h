@@ -0,0 +1,46 @@
+#pragma once
+
+
+#include "sxs_manifest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+struct sxs_catalog_entry
+{
+	std::string m_arch;
+	std::string m_name;
+	std::string m_token;
+	std::string m_language;
+	std::uint64_t m_version;
+	std::wstring m_dir;
+};
+
+
+class sxs_catalog
+{
+public:
+	sxs_catalog() noexcept;
+	sxs_catalog(sxs_catalog const&) = delete;
+	sxs_catalog& operator=(sxs_catalog const&) = delete;
+	~sxs_catalog() noexcept;
+public:
+	bool init(std::wstring const& winsxs_dir);
+	std::wstring const* resolve(sxs_assembly_identity const& identity, bool const is_32_bit);
+	int get_count() const;
+	int get_hits() const;
+	int get_misses() const;
+private:
+	sxs_catalog_entry const* find(sxs_assembly_identity const& identity, std::string const& arch) const;
+private:
+	std::vector<sxs_catalog_entry> m_entries;
+	std::mutex m_mutex;
+	std::unordered_map<std::string, sxs_catalog_entry const*> m_cache;
+	std::atomic<int> m_hits;
+	std::atomic<int> m_misses;
+};
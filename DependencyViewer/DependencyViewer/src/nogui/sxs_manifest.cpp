@@ -0,0 +1,265 @@
+#include "sxs_manifest.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "unicode.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+
+enum class sxs_manifest_element : std::uint8_t
+{
+	root,
+	other,
+	assembly,
+	identity,
+	dependency,
+	dependent_assembly,
+	file,
+};
+
+
+static bool sxs_manifest_is_space(char const ch);
+static std::string_view sxs_manifest_local_name(std::string_view const name);
+static sxs_manifest_element sxs_manifest_classify(sxs_manifest_element const parent, std::string_view const name);
+static void sxs_manifest_assign_lowercase(std::string_view const value, std::string* const str_out);
+static void sxs_manifest_apply_attribute(sxs_manifest_element const element, std::string_view const name, std::string_view const value, sxs_assembly_identity* const identity, sxs_manifest& manifest);
+
+
+bool sxs_parse_manifest(char const* const data, int const size, sxs_manifest* const manifest_out)
+{
+	assert(data || size == 0);
+	assert(manifest_out);
+	sxs_manifest& manifest = *manifest_out;
+	manifest.m_identity = sxs_assembly_identity{};
+	manifest.m_dependencies.clear();
+	manifest.m_files.clear();
+	std::string_view xml{data, static_cast<std::size_t>(size)};
+	if(xml.starts_with("\xEF\xBB\xBF"))
+	{
+		xml.remove_prefix(3);
+	}
+	WARN_M_R(!xml.starts_with("\xFF\xFE") && !xml.starts_with("\xFE\xFF"), L"UTF-16 manifests are not supported.", false);
+	std::vector<sxs_manifest_element> stack;
+	std::size_t pos = 0;
+	for(;;)
+	{
+		std::size_t const lt = xml.find('<', pos);
+		if(lt == std::string_view::npos)
+		{
+			break;
+		}
+		std::string_view const rest = xml.substr(lt);
+		if(rest.starts_with("<!--"))
+		{
+			std::size_t const end = xml.find("-->", lt);
+			WARN_M_R(end != std::string_view::npos, L"Unterminated comment.", false);
+			pos = end + 3;
+			continue;
+		}
+		if(rest.starts_with("<![CDATA["))
+		{
+			std::size_t const end = xml.find("]]>", lt);
+			WARN_M_R(end != std::string_view::npos, L"Unterminated CDATA.", false);
+			pos = end + 3;
+			continue;
+		}
+		if(rest.starts_with("<?") || rest.starts_with("<!") || rest.starts_with("</"))
+		{
+			std::size_t const end = xml.find('>', lt);
+			WARN_M_R(end != std::string_view::npos, L"Unterminated markup.", false);
+			if(rest.starts_with("</"))
+			{
+				WARN_M_R(!stack.empty(), L"Unbalanced end element.", false);
+				stack.pop_back();
+			}
+			pos = end + 1;
+			continue;
+		}
+		std::size_t i = lt + 1;
+		std::size_t const name_begin = i;
+		while(i != xml.size() && !sxs_manifest_is_space(xml[i]) && xml[i] != '>' && xml[i] != '/')
+		{
+			++i;
+		}
+		sxs_manifest_element const parent = stack.empty() ? sxs_manifest_element::root : stack.back();
+		sxs_manifest_element const element = sxs_manifest_classify(parent, sxs_manifest_local_name(xml.substr(name_begin, i - name_begin)));
+		sxs_assembly_identity* identity = nullptr;
+		if(element == sxs_manifest_element::identity)
+		{
+			identity = parent == sxs_manifest_element::assembly ? &manifest.m_identity : &manifest.m_dependencies.emplace_back();
+		}
+		else if(element == sxs_manifest_element::file)
+		{
+			manifest.m_files.emplace_back();
+		}
+		for(;;)
+		{
+			while(i != xml.size() && sxs_manifest_is_space(xml[i]))
+			{
+				++i;
+			}
+			WARN_M_R(i != xml.size(), L"Unterminated element.", false);
+			if(xml[i] == '>')
+			{
+				stack.push_back(element);
+				++i;
+				break;
+			}
+			if(xml[i] == '/')
+			{
+				WARN_M_R(i + 1 != xml.size() && xml[i + 1] == '>', L"Malformed element.", false);
+				i += 2;
+				break;
+			}
+			std::size_t const attr_begin = i;
+			while(i != xml.size() && !sxs_manifest_is_space(xml[i]) && xml[i] != '=')
+			{
+				++i;
+			}
+			std::string_view const attr_name = xml.substr(attr_begin, i - attr_begin);
+			while(i != xml.size() && sxs_manifest_is_space(xml[i]))
+			{
+				++i;
+			}
+			WARN_M_R(i != xml.size() && xml[i] == '=', L"Malformed attribute.", false);
+			++i;
+			while(i != xml.size() && sxs_manifest_is_space(xml[i]))
+			{
+				++i;
+			}
+			WARN_M_R(i != xml.size() && (xml[i] == '"' || xml[i] == '\''), L"Malformed attribute value.", false);
+			std::size_t const value_end = xml.find(xml[i], i + 1);
+			WARN_M_R(value_end != std::string_view::npos, L"Unterminated attribute value.", false);
+			std::string_view const attr_value = xml.substr(i + 1, value_end - (i + 1));
+			sxs_manifest_apply_attribute(element, attr_name, attr_value, identity, manifest);
+			i = value_end + 1;
+		}
+		pos = i;
+	}
+	return true;
+}
+
+bool sxs_read_manifest_file(wchar_t const* const file_path, bool* const found_out, sxs_manifest* const manifest_out)
+{
+	assert(file_path);
+	assert(found_out);
+	std::ifstream file{std::filesystem::path{file_path}, std::ios::in | std::ios::binary};
+	*found_out = file.is_open();
+	if(!*found_out)
+	{
+		return true;
+	}
+	std::string const data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+	WARN_M_R(!file.bad(), L"Failed to read manifest file.", false);
+	return sxs_parse_manifest(data.c_str(), static_cast<int>(data.size()), manifest_out);
+}
+
+bool sxs_parse_version(char const* const str, int const len, std::uint64_t* const version_out)
+{
+	assert(str || len == 0);
+	assert(version_out);
+	std::uint64_t version = 0;
+	int parts = 0;
+	std::uint32_t part = 0;
+	bool has_digit = false;
+	for(int i = 0; i != len + 1; ++i)
+	{
+		if(i == len || str[i] == '.')
+		{
+			WARN_M_R(has_digit && parts != 4, L"Malformed version.", false);
+			version = (version << 16) | part;
+			++parts;
+			part = 0;
+			has_digit = false;
+			continue;
+		}
+		WARN_M_R(str[i] >= '0' && str[i] <= '9', L"Malformed version.", false);
+		part = part * 10 + static_cast<std::uint32_t>(str[i] - '0');
+		WARN_M_R(part <= 0xFFFF, L"Malformed version.", false);
+		has_digit = true;
+	}
+	WARN_M_R(parts == 4, L"Malformed version.", false);
+	*version_out = version;
+	return true;
+}
+
+
+bool sxs_manifest_is_space(char const ch)
+{
+	return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+}
+
+std::string_view sxs_manifest_local_name(std::string_view const name)
+{
+	std::size_t const colon = name.find(':');
+	return colon == std::string_view::npos ? name : name.substr(colon + 1);
+}
+
+sxs_manifest_element sxs_manifest_classify(sxs_manifest_element const parent, std::string_view const name)
+{
+	switch(parent)
+	{
+		case sxs_manifest_element::root:
+			return name == "assembly" ? sxs_manifest_element::assembly : sxs_manifest_element::other;
+		case sxs_manifest_element::assembly:
+			if(name == "assemblyIdentity") return sxs_manifest_element::identity;
+			if(name == "dependency") return sxs_manifest_element::dependency;
+			if(name == "file") return sxs_manifest_element::file;
+			return sxs_manifest_element::other;
+		case sxs_manifest_element::dependency:
+			return name == "dependentAssembly" ? sxs_manifest_element::dependent_assembly : sxs_manifest_element::other;
+		case sxs_manifest_element::dependent_assembly:
+			return name == "assemblyIdentity" ? sxs_manifest_element::identity : sxs_manifest_element::other;
+		default:
+			return sxs_manifest_element::other;
+	}
+}
+
+void sxs_manifest_assign_lowercase(std::string_view const value, std::string* const str_out)
+{
+	assert(str_out);
+	str_out->resize(value.size());
+	std::transform(value.begin(), value.end(), str_out->begin(), [](char const& ch){ return to_lowercase(ch); });
+}
+
+void sxs_manifest_apply_attribute(sxs_manifest_element const element, std::string_view const name, std::string_view const value, sxs_assembly_identity* const identity, sxs_manifest& manifest)
+{
+	if(element == sxs_manifest_element::file)
+	{
+		if(name == "name")
+		{
+			sxs_manifest_assign_lowercase(value, &manifest.m_files.back());
+		}
+		return;
+	}
+	if(!identity)
+	{
+		return;
+	}
+	if(name == "name")
+	{
+		sxs_manifest_assign_lowercase(value, &identity->m_name);
+	}
+	else if(name == "processorArchitecture")
+	{
+		sxs_manifest_assign_lowercase(value, &identity->m_arch);
+	}
+	else if(name == "publicKeyToken")
+	{
+		sxs_manifest_assign_lowercase(value, &identity->m_token);
+	}
+	else if(name == "language")
+	{
+		sxs_manifest_assign_lowercase(value, &identity->m_language);
+	}
+	else if(name == "version")
+	{
+		bool const version_parsed = sxs_parse_version(value.data(), static_cast<int>(value.size()), &identity->m_version);
+		WARN_M(version_parsed, L"Failed to sxs_parse_version.");
+	}
+}
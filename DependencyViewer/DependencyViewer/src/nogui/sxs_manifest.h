@@ -0,0 +1,28 @@
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+struct sxs_assembly_identity
+{
+	std::string m_name;
+	std::string m_arch;
+	std::string m_token;
+	std::string m_language;
+	std::uint64_t m_version;
+};
+
+struct sxs_manifest
+{
+	sxs_assembly_identity m_identity;
+	std::vector<sxs_assembly_identity> m_dependencies;
+	std::vector<std::string> m_files;
+};
+
+
+bool sxs_parse_manifest(char const* const data, int const size, sxs_manifest* const manifest_out);
+bool sxs_read_manifest_file(wchar_t const* const file_path, bool* const found_out, sxs_manifest* const manifest_out);
+bool sxs_parse_version(char const* const str, int const len, std::uint64_t* const version_out);
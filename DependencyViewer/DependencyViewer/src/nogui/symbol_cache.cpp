@@ -0,0 +1,431 @@
+#include "symbol_cache.h"
+
+#include "assert_my.h"
+#include "cassert_my.h"
+#include "scope_exit.h"
+#include "utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cwctype>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include "my_windows.h"
+
+#include <objbase.h>
+#include <shlobj.h>
+
+
+struct symbol_cache_header
+{
+	char m_magic[4];
+	std::uint32_t m_version;
+	std::uint32_t m_module_count;
+	std::uint32_t m_symbol_count;
+	std::uint32_t m_undecoration_count;
+	std::uint32_t m_strings_size;
+};
+static_assert(sizeof(symbol_cache_header) == 0x18, "");
+
+struct symbol_cache_module
+{
+	std::uint32_t m_key_offset;
+	std::uint32_t m_key_len;
+	std::uint32_t m_first_symbol;
+	std::uint32_t m_symbol_count;
+};
+static_assert(sizeof(symbol_cache_module) == 0x10, "");
+
+struct symbol_cache_symbol
+{
+	std::uint32_t m_rva;
+	std::uint32_t m_name_offset;
+	std::uint32_t m_name_len;
+};
+static_assert(sizeof(symbol_cache_symbol) == 0xC, "");
+
+struct symbol_cache_undecoration
+{
+	std::uint32_t m_decorated_offset;
+	std::uint32_t m_decorated_len;
+	std::uint32_t m_undecorated_offset;
+	std::uint32_t m_undecorated_len;
+};
+static_assert(sizeof(symbol_cache_undecoration) == 0x10, "");
+
+
+static constexpr char const s_symbol_cache_magic[] = {'D', 'V', 'S', 'C'};
+static constexpr std::uint32_t const s_symbol_cache_version = 3;
+static constexpr std::size_t const s_symbol_cache_max_size = 256 * 1024 * 1024;
+
+
+static std::mutex g_symbol_cache_mutex;
+static symbol_cache* g_symbol_cache;
+
+
+static std::string_view symbol_cache_get_str(char const* const strings, std::uint32_t const offset, std::uint32_t const len);
+static std::wstring symbol_cache_get_file_path();
+
+
+symbol_cache::symbol_cache() noexcept :
+	m_mmf(),
+	m_modules(),
+	m_module_count(),
+	m_symbols(),
+	m_symbol_count(),
+	m_undecorations(),
+	m_undecoration_count(),
+	m_strings(),
+	m_new_symbols(),
+	m_new_undecorations()
+{
+}
+
+symbol_cache::~symbol_cache() noexcept
+{
+}
+
+bool symbol_cache::init(wchar_t const* const file_path)
+{
+	assert(file_path);
+	memory_mapped_file mmf(file_path);
+	WARN_M_R(mmf.begin(), L"Failed to map symbol cache.", false);
+	std::byte const* const data = mmf.begin();
+	std::uint64_t const size = static_cast<std::uint64_t>(mmf.size());
+	WARN_M_R(size >= sizeof(symbol_cache_header), L"Symbol cache is too small.", false);
+	symbol_cache_header const& header = *reinterpret_cast<symbol_cache_header const*>(data);
+	if(std::memcmp(header.m_magic, s_symbol_cache_magic, sizeof(header.m_magic)) != 0 || header.m_version != s_symbol_cache_version)
+	{
+		return false;
+	}
+	std::uint64_t const modules_size = static_cast<std::uint64_t>(header.m_module_count) * sizeof(symbol_cache_module);
+	std::uint64_t const symbols_size = static_cast<std::uint64_t>(header.m_symbol_count) * sizeof(symbol_cache_symbol);
+	std::uint64_t const undecorations_size = static_cast<std::uint64_t>(header.m_undecoration_count) * sizeof(symbol_cache_undecoration);
+	WARN_M_R(sizeof(symbol_cache_header) + modules_size + symbols_size + undecorations_size + header.m_strings_size == size, L"Symbol cache has wrong size.", false);
+	symbol_cache_module const* const modules = reinterpret_cast<symbol_cache_module const*>(data + sizeof(symbol_cache_header));
+	symbol_cache_symbol const* const symbols = reinterpret_cast<symbol_cache_symbol const*>(data + sizeof(symbol_cache_header) + modules_size);
+	symbol_cache_undecoration const* const undecorations = reinterpret_cast<symbol_cache_undecoration const*>(data + sizeof(symbol_cache_header) + modules_size + symbols_size);
+	char const* const strings = reinterpret_cast<char const*>(data + sizeof(symbol_cache_header) + modules_size + symbols_size + undecorations_size);
+	std::uint64_t const strings_size = header.m_strings_size;
+	bool const modules_valid = std::all_of(modules, modules + header.m_module_count, [&](symbol_cache_module const& e)
+	{
+		return
+			static_cast<std::uint64_t>(e.m_key_offset) + e.m_key_len <= strings_size &&
+			static_cast<std::uint64_t>(e.m_first_symbol) + e.m_symbol_count <= header.m_symbol_count &&
+			std::adjacent_find(symbols + e.m_first_symbol, symbols + e.m_first_symbol + e.m_symbol_count, [](symbol_cache_symbol const& a, symbol_cache_symbol const& b){ return !(a.m_rva < b.m_rva); }) == symbols + e.m_first_symbol + e.m_symbol_count;
+	});
+	WARN_M_R(modules_valid, L"Symbol cache module out of bounds.", false);
+	bool const symbols_valid = std::all_of(symbols, symbols + header.m_symbol_count, [&](symbol_cache_symbol const& e){ return static_cast<std::uint64_t>(e.m_name_offset) + e.m_name_len <= strings_size; });
+	WARN_M_R(symbols_valid, L"Symbol cache symbol out of bounds.", false);
+	bool const undecorations_valid = std::all_of(undecorations, undecorations + header.m_undecoration_count, [&](symbol_cache_undecoration const& e){ return static_cast<std::uint64_t>(e.m_decorated_offset) + e.m_decorated_len <= strings_size && static_cast<std::uint64_t>(e.m_undecorated_offset) + e.m_undecorated_len <= strings_size; });
+	WARN_M_R(undecorations_valid, L"Symbol cache undecoration out of bounds.", false);
+	bool const modules_sorted = std::adjacent_find(modules, modules + header.m_module_count, [&](symbol_cache_module const& a, symbol_cache_module const& b){ return !(symbol_cache_get_str(strings, a.m_key_offset, a.m_key_len) < symbol_cache_get_str(strings, b.m_key_offset, b.m_key_len)); }) == modules + header.m_module_count;
+	WARN_M_R(modules_sorted, L"Symbol cache modules are not sorted.", false);
+	bool const undecorations_sorted = std::adjacent_find(undecorations, undecorations + header.m_undecoration_count, [&](symbol_cache_undecoration const& a, symbol_cache_undecoration const& b){ return !(symbol_cache_get_str(strings, a.m_decorated_offset, a.m_decorated_len) < symbol_cache_get_str(strings, b.m_decorated_offset, b.m_decorated_len)); }) == undecorations + header.m_undecoration_count;
+	WARN_M_R(undecorations_sorted, L"Symbol cache undecorations are not sorted.", false);
+	m_mmf = std::move(mmf);
+	m_modules = modules;
+	m_module_count = static_cast<int>(header.m_module_count);
+	m_symbols = symbols;
+	m_symbol_count = static_cast<int>(header.m_symbol_count);
+	m_undecorations = undecorations;
+	m_undecoration_count = static_cast<int>(header.m_undecoration_count);
+	m_strings = strings;
+	return true;
+}
+
+bool symbol_cache::save(wchar_t const* const file_path)
+{
+	assert(file_path);
+	if(m_new_symbols.empty() && m_new_undecorations.empty())
+	{
+		return true;
+	}
+	std::vector<std::byte> const buff = serialize();
+	WARN_M_R(buff.size() <= s_symbol_cache_max_size, L"Symbol cache is too big.", false);
+	m_mmf = memory_mapped_file{};
+	m_modules = nullptr;
+	m_module_count = 0;
+	m_symbols = nullptr;
+	m_symbol_count = 0;
+	m_undecorations = nullptr;
+	m_undecoration_count = 0;
+	m_strings = nullptr;
+	m_new_symbols.clear();
+	m_new_undecorations.clear();
+	std::filesystem::path const path{file_path};
+	std::filesystem::path tmp_path = path;
+	tmp_path += L".tmp";
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+	{
+		std::ofstream file{tmp_path, std::ios::out | std::ios::binary | std::ios::trunc};
+		WARN_M_R(file, L"Failed to create symbol cache.", false);
+		file.write(reinterpret_cast<char const*>(buff.data()), static_cast<std::streamsize>(buff.size()));
+		file.close();
+		WARN_M_R(file, L"Failed to write symbol cache.", false);
+	}
+	// Another instance might still have the old file mapped, in that case its own copy wins on exit.
+	std::filesystem::rename(tmp_path, path, ec);
+	if(ec)
+	{
+		std::filesystem::remove(tmp_path, ec);
+		return false;
+	}
+	return init(file_path);
+}
+
+bool symbol_cache::find_symbol(std::string_view const& module_key, std::uint32_t const rva, string* const name_out) const
+{
+	assert(!module_key.empty());
+	assert(name_out);
+	auto const new_module = m_new_symbols.find(module_key);
+	if(new_module != m_new_symbols.end())
+	{
+		auto const it = new_module->second.find(rva);
+		if(it != new_module->second.end())
+		{
+			name_out->m_str = it->second.c_str();
+			name_out->m_len = static_cast<int>(it->second.size());
+			return true;
+		}
+	}
+	symbol_cache_module const* const modules_end = m_modules + m_module_count;
+	symbol_cache_module const* const module = std::lower_bound(m_modules, modules_end, module_key, [&](symbol_cache_module const& e, std::string_view const& k){ return symbol_cache_get_str(m_strings, e.m_key_offset, e.m_key_len) < k; });
+	if(module == modules_end || symbol_cache_get_str(m_strings, module->m_key_offset, module->m_key_len) != module_key)
+	{
+		return false;
+	}
+	symbol_cache_symbol const* const symbols_begin = m_symbols + module->m_first_symbol;
+	symbol_cache_symbol const* const symbols_end = symbols_begin + module->m_symbol_count;
+	symbol_cache_symbol const* const symbol = std::lower_bound(symbols_begin, symbols_end, rva, [](symbol_cache_symbol const& e, std::uint32_t const& r){ return e.m_rva < r; });
+	if(symbol == symbols_end || symbol->m_rva != rva)
+	{
+		return false;
+	}
+	name_out->m_str = m_strings + symbol->m_name_offset;
+	name_out->m_len = static_cast<int>(symbol->m_name_len);
+	return true;
+}
+
+void symbol_cache::add_symbol(std::string_view const& module_key, std::uint32_t const rva, std::string const& name)
+{
+	assert(!module_key.empty());
+	assert(!name.empty());
+	string cached;
+	if(find_symbol(module_key, rva, &cached) && std::string_view{cached.m_str, static_cast<std::size_t>(cached.m_len)} == name)
+	{
+		return;
+	}
+	auto it = m_new_symbols.find(module_key);
+	if(it == m_new_symbols.end())
+	{
+		it = m_new_symbols.emplace(std::string{module_key}, std::map<std::uint32_t, std::string>{}).first;
+	}
+	it->second.insert_or_assign(rva, name);
+}
+
+bool symbol_cache::find_undecoration(string const& decorated, string* const undecorated_out) const
+{
+	assert(undecorated_out);
+	std::string_view const decorated_sv{decorated.m_str, static_cast<std::size_t>(decorated.m_len)};
+	auto const it = m_new_undecorations.find(decorated_sv);
+	if(it != m_new_undecorations.end())
+	{
+		undecorated_out->m_str = it->second.c_str();
+		undecorated_out->m_len = static_cast<int>(it->second.size());
+		return true;
+	}
+	symbol_cache_undecoration const* const undecorations_end = m_undecorations + m_undecoration_count;
+	symbol_cache_undecoration const* const undecoration = std::lower_bound(m_undecorations, undecorations_end, decorated_sv, [&](symbol_cache_undecoration const& e, std::string_view const& d){ return symbol_cache_get_str(m_strings, e.m_decorated_offset, e.m_decorated_len) < d; });
+	if(undecoration == undecorations_end || symbol_cache_get_str(m_strings, undecoration->m_decorated_offset, undecoration->m_decorated_len) != decorated_sv)
+	{
+		return false;
+	}
+	undecorated_out->m_str = m_strings + undecoration->m_undecorated_offset;
+	undecorated_out->m_len = static_cast<int>(undecoration->m_undecorated_len);
+	return true;
+}
+
+void symbol_cache::add_undecoration(string const& decorated, std::string const& undecorated)
+{
+	assert(!undecorated.empty());
+	string cached;
+	if(find_undecoration(decorated, &cached) && std::string_view{cached.m_str, static_cast<std::size_t>(cached.m_len)} == undecorated)
+	{
+		return;
+	}
+	m_new_undecorations.insert_or_assign(std::string{decorated.m_str, decorated.m_str + decorated.m_len}, undecorated);
+}
+
+int symbol_cache::get_count() const
+{
+	int const new_symbols = std::accumulate(m_new_symbols.begin(), m_new_symbols.end(), 0, [](int const& acc, auto const& e){ return acc + static_cast<int>(e.second.size()); });
+	return m_symbol_count + m_undecoration_count + new_symbols + static_cast<int>(m_new_undecorations.size());
+}
+
+std::vector<std::byte> symbol_cache::serialize() const
+{
+	std::map<std::string_view, std::map<std::uint32_t, std::string_view>> symbols;
+	std::for_each(m_modules, m_modules + m_module_count, [&](symbol_cache_module const& e)
+	{
+		std::map<std::uint32_t, std::string_view>& module = symbols[symbol_cache_get_str(m_strings, e.m_key_offset, e.m_key_len)];
+		std::for_each(m_symbols + e.m_first_symbol, m_symbols + e.m_first_symbol + e.m_symbol_count, [&](symbol_cache_symbol const& s){ module.emplace(s.m_rva, symbol_cache_get_str(m_strings, s.m_name_offset, s.m_name_len)); });
+	});
+	std::for_each(m_new_symbols.begin(), m_new_symbols.end(), [&](auto const& e)
+	{
+		std::map<std::uint32_t, std::string_view>& module = symbols[std::string_view{e.first}];
+		std::for_each(e.second.begin(), e.second.end(), [&](auto const& s){ module.insert_or_assign(s.first, std::string_view{s.second}); });
+	});
+	std::map<std::string_view, std::string_view> undecorations;
+	std::for_each(m_undecorations, m_undecorations + m_undecoration_count, [&](symbol_cache_undecoration const& e){ undecorations.emplace(symbol_cache_get_str(m_strings, e.m_decorated_offset, e.m_decorated_len), symbol_cache_get_str(m_strings, e.m_undecorated_offset, e.m_undecorated_len)); });
+	std::for_each(m_new_undecorations.begin(), m_new_undecorations.end(), [&](auto const& e){ undecorations.insert_or_assign(std::string_view{e.first}, std::string_view{e.second}); });
+
+	std::vector<char> strings;
+	std::unordered_map<std::string_view, std::uint32_t> offsets;
+	auto const fn_add_string = [&](std::string_view const& str) -> std::uint32_t
+	{
+		auto const it = offsets.find(str);
+		if(it != offsets.end())
+		{
+			return it->second;
+		}
+		std::uint32_t const offset = static_cast<std::uint32_t>(strings.size());
+		strings.insert(strings.end(), str.begin(), str.end());
+		offsets.emplace(str, offset);
+		return offset;
+	};
+	std::vector<symbol_cache_module> module_entries;
+	module_entries.reserve(symbols.size());
+	std::vector<symbol_cache_symbol> symbol_entries;
+	for(auto const& module : symbols)
+	{
+		std::uint32_t const key_offset = fn_add_string(module.first);
+		module_entries.push_back(symbol_cache_module{key_offset, static_cast<std::uint32_t>(module.first.size()), static_cast<std::uint32_t>(symbol_entries.size()), static_cast<std::uint32_t>(module.second.size())});
+		for(auto const& e : module.second)
+		{
+			symbol_entries.push_back(symbol_cache_symbol{e.first, fn_add_string(e.second), static_cast<std::uint32_t>(e.second.size())});
+		}
+	}
+	std::vector<symbol_cache_undecoration> undecoration_entries;
+	undecoration_entries.reserve(undecorations.size());
+	for(auto const& e : undecorations)
+	{
+		std::uint32_t const decorated_offset = fn_add_string(e.first);
+		std::uint32_t const undecorated_offset = fn_add_string(e.second);
+		undecoration_entries.push_back(symbol_cache_undecoration{decorated_offset, static_cast<std::uint32_t>(e.first.size()), undecorated_offset, static_cast<std::uint32_t>(e.second.size())});
+	}
+
+	symbol_cache_header header;
+	std::memcpy(header.m_magic, s_symbol_cache_magic, sizeof(header.m_magic));
+	header.m_version = s_symbol_cache_version;
+	header.m_module_count = static_cast<std::uint32_t>(module_entries.size());
+	header.m_symbol_count = static_cast<std::uint32_t>(symbol_entries.size());
+	header.m_undecoration_count = static_cast<std::uint32_t>(undecoration_entries.size());
+	header.m_strings_size = static_cast<std::uint32_t>(strings.size());
+	std::size_t const modules_size = module_entries.size() * sizeof(symbol_cache_module);
+	std::size_t const symbols_size = symbol_entries.size() * sizeof(symbol_cache_symbol);
+	std::size_t const undecorations_size = undecoration_entries.size() * sizeof(symbol_cache_undecoration);
+	std::vector<std::byte> buff(sizeof(header) + modules_size + symbols_size + undecorations_size + strings.size());
+	std::byte* ptr = buff.data();
+	std::memcpy(ptr, &header, sizeof(header));
+	ptr += sizeof(header);
+	std::memcpy(ptr, module_entries.data(), modules_size);
+	ptr += modules_size;
+	std::memcpy(ptr, symbol_entries.data(), symbols_size);
+	ptr += symbols_size;
+	std::memcpy(ptr, undecoration_entries.data(), undecorations_size);
+	ptr += undecorations_size;
+	std::memcpy(ptr, strings.data(), strings.size());
+	return buff;
+}
+
+
+std::string make_symbol_cache_module_key(wstring const& file_path, std::uint32_t const time_date_stamp, std::uint32_t const image_size, std::uint8_t const* const pdb_guid, std::uint32_t const pdb_age)
+{
+	assert(pdb_guid);
+	// A zero stamp (MinGW and some reproducible builds) does not identify the module, do not cache those.
+	if(time_date_stamp == 0)
+	{
+		return std::string{};
+	}
+	wchar_t const* const file_name = find_file_name(file_path.m_str, file_path.m_len);
+	wchar_t const* const file_path_end = file_path.m_str + file_path.m_len;
+	std::string key(sizeof(time_date_stamp) + sizeof(image_size) + 16 + sizeof(pdb_age), '\0');
+	char* ptr = key.data();
+	std::memcpy(ptr, &time_date_stamp, sizeof(time_date_stamp));
+	ptr += sizeof(time_date_stamp);
+	std::memcpy(ptr, &image_size, sizeof(image_size));
+	ptr += sizeof(image_size);
+	std::memcpy(ptr, pdb_guid, 16);
+	ptr += 16;
+	std::memcpy(ptr, &pdb_age, sizeof(pdb_age));
+	std::for_each(file_name, file_path_end, [&](wchar_t const& e)
+	{
+		wchar_t const ch = static_cast<wchar_t>(std::towlower(e));
+		key.append(reinterpret_cast<char const*>(&ch), sizeof(ch));
+	});
+	return key;
+}
+
+
+void symbol_caches::deinit()
+{
+	std::lock_guard<std::mutex> const lck(g_symbol_cache_mutex);
+	if(g_symbol_cache)
+	{
+		std::wstring const file_path = symbol_cache_get_file_path();
+		if(!file_path.empty())
+		{
+			g_symbol_cache->save(file_path.c_str());
+		}
+		delete g_symbol_cache;
+		g_symbol_cache = nullptr;
+	}
+}
+
+symbol_cache* symbol_caches::get()
+{
+	std::lock_guard<std::mutex> const lck(g_symbol_cache_mutex);
+	if(!g_symbol_cache)
+	{
+		g_symbol_cache = new symbol_cache();
+		std::wstring const file_path = symbol_cache_get_file_path();
+		std::error_code ec;
+		if(!file_path.empty() && std::filesystem::is_regular_file(std::filesystem::path{file_path}, ec))
+		{
+			g_symbol_cache->init(file_path.c_str());
+		}
+	}
+	return g_symbol_cache;
+}
+
+
+std::string_view symbol_cache_get_str(char const* const strings, std::uint32_t const offset, std::uint32_t const len)
+{
+	return std::string_view{strings + offset, len};
+}
+
+std::wstring symbol_cache_get_file_path()
+{
+	static constexpr wchar_t const s_partial_path[] = LR"---(DependencyViewer\symbol_cache.bin)---";
+	static constexpr auto const s_folder_id = GUID{0xF1B32785, 0x6FBA, 0x4FCF, {0x9D, 0x55, 0x7B, 0x8E, 0x7F, 0x15, 0x70, 0x91}}; // FOLDERID_LocalAppData
+	wchar_t* local_app_data = nullptr;
+	HRESULT const hr = SHGetKnownFolderPath(s_folder_id, KF_FLAG_DEFAULT, nullptr, &local_app_data);
+	auto const free_local_app_data = mk::make_scope_exit([&](){ CoTaskMemFree(local_app_data); });
+	if(hr != S_OK)
+	{
+		return std::wstring{};
+	}
+	std::filesystem::path p(local_app_data);
+	p.append(s_partial_path);
+	return p.wstring();
+}
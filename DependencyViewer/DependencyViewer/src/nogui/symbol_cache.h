@@ -0,0 +1,59 @@
+#pragma once
+
+
+#include "memory_mapped_file.h"
+#include "my_string.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+struct symbol_cache_module;
+struct symbol_cache_symbol;
+struct symbol_cache_undecoration;
+
+
+class symbol_cache
+{
+public:
+	symbol_cache() noexcept;
+	symbol_cache(symbol_cache const&) = delete;
+	symbol_cache& operator=(symbol_cache const&) = delete;
+	~symbol_cache() noexcept;
+public:
+	bool init(wchar_t const* const file_path);
+	bool save(wchar_t const* const file_path);
+	bool find_symbol(std::string_view const& module_key, std::uint32_t const rva, string* const name_out) const;
+	void add_symbol(std::string_view const& module_key, std::uint32_t const rva, std::string const& name);
+	bool find_undecoration(string const& decorated, string* const undecorated_out) const;
+	void add_undecoration(string const& decorated, std::string const& undecorated);
+	int get_count() const;
+private:
+	std::vector<std::byte> serialize() const;
+private:
+	memory_mapped_file m_mmf;
+	symbol_cache_module const* m_modules;
+	int m_module_count;
+	symbol_cache_symbol const* m_symbols;
+	int m_symbol_count;
+	symbol_cache_undecoration const* m_undecorations;
+	int m_undecoration_count;
+	char const* m_strings;
+	std::map<std::string, std::map<std::uint32_t, std::string>, std::less<>> m_new_symbols;
+	std::map<std::string, std::string, std::less<>> m_new_undecorations;
+};
+
+
+std::string make_symbol_cache_module_key(wstring const& file_path, std::uint32_t const time_date_stamp, std::uint32_t const image_size, std::uint8_t const* const pdb_guid, std::uint32_t const pdb_age);
+
+
+namespace symbol_caches
+{
+	void deinit();
+	symbol_cache* get();
+}
@@ -1,4 +1,4 @@
-#pragma once
-
-
-void name_current_thread(char const* const name_a, wchar_t const* const name_w);
+#pragma once
+
+
+void name_current_thread(char const* const name_a, wchar_t const* const name_w);
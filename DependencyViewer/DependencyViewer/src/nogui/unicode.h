@@ -1,7 +1,7 @@
-#pragma once
-
-
-template<typename char_t>
-bool is_ascii(char_t const* const str, int const size);
-template<typename char_t>
-char_t to_lowercase(char_t const ch);
+#pragma once
+
+
+template<typename char_t>
+bool is_ascii(char_t const* const str, int const size);
+template<typename char_t>
+char_t to_lowercase(char_t const ch);
@@ -1,6 +1,6 @@
-#pragma once
-
-
-#ifdef _M_IX86
-bool is_wow64();
-#endif
+#pragma once
+
+
+#ifdef _M_IX86
+bool is_wow64();
+#endif
@@ -1,83 +1,83 @@
-#pragma once
-
-
-#define s_res_dependency_manifest 17
-
-
-#define s_res_icons_tree 2
-
-#define s_res_icon_tree_missing 0
-#define s_res_icon_tree_invalid 1
-#define s_res_icon_tree_32b 2
-#define s_res_icon_tree_32b_dup 3
-#define s_res_icon_tree_32b_wrn 4
-#define s_res_icon_tree_32b_wrn_dup 5
-#define s_res_icon_tree_64b 6
-#define s_res_icon_tree_64b_dup 7
-#define s_res_icon_tree_64b_wrn 8
-#define s_res_icon_tree_64b_wrn_dup 9
-#define s_res_icon_tree_fwd_missing 10
-#define s_res_icon_tree_fwd_invalid 11
-#define s_res_icon_tree_fwd_32b 12
-#define s_res_icon_tree_fwd_32b_dup 13
-#define s_res_icon_tree_fwd_32b_wrn 14
-#define s_res_icon_tree_fwd_32b_wrn_dup 15
-#define s_res_icon_tree_fwd_64b 16
-#define s_res_icon_tree_fwd_64b_dup 17
-#define s_res_icon_tree_fwd_64b_wrn 18
-#define s_res_icon_tree_fwd_64b_wrn_dup 19
-#define s_res_icon_tree_dly_missing 20
-#define s_res_icon_tree_dly_invalid 21
-#define s_res_icon_tree_dly_32b 22 
-#define s_res_icon_tree_dly_32b_dup 23
-#define s_res_icon_tree_dly_32b_wrn 24
-#define s_res_icon_tree_dly_32b_wrn_dup 25
-#define s_res_icon_tree_dly_64b 26
-#define s_res_icon_tree_dly_64b_dup 27
-#define s_res_icon_tree_dly_64b_wrn 28
-#define s_res_icon_tree_dly_64b_wrn_dup 29
-#define s_res_icon_tree_dnm_missing 30
-#define s_res_icon_tree_dnm_invalid 31
-#define s_res_icon_tree_dnm_32b 32
-#define s_res_icon_tree_dnm_32b_dup 33
-#define s_res_icon_tree_dnm_32b_wrn 34
-#define s_res_icon_tree_dnm_32b_wrn_dup 35
-#define s_res_icon_tree_dnm_64b 36
-#define s_res_icon_tree_dnm_64b_dup 37
-#define s_res_icon_tree_dnm_64b_wrn 38
-#define s_res_icon_tree_dnm_64b_wrn_dup 39
-
-
-
-#define s_res_icons_toolbar 3
-
-#define s_res_icon_open 0
-#define s_res_icon_full_paths 4
-#define s_res_icon_undecorate 5
-#define s_res_icon_properties 7
-
-
-
-#define s_res_icons_import_export 4
-
-#define s_res_icon_import_not_found_c 0
-#define s_res_icon_import_not_found_o 2
-#define s_res_icon_import_found_c 6
-#define s_res_icon_import_found_o 8
-
-#define s_res_icon_export0000 29
-#define s_res_icon_export0001 27
-#define s_res_icon_export0010 26
-#define s_res_icon_export0011 24
-//#define s_res_icon_export0100 -1
-//#define s_res_icon_export0101 -1
-//#define s_res_icon_export0110 -1
-//#define s_res_icon_export0111 -1
-#define s_res_icon_export1000 23
-#define s_res_icon_export1001 21
-#define s_res_icon_export1010 20
-#define s_res_icon_export1011 18
-#define s_res_icon_export1100 17
-#define s_res_icon_export1101 15
-#define s_res_icon_export1110 14
-#define s_res_icon_export1111 12
+#pragma once
+
+
+#define s_res_dependency_manifest 17
+
+
+#define s_res_icons_tree 2
+
+#define s_res_icon_tree_missing 0
+#define s_res_icon_tree_invalid 1
+#define s_res_icon_tree_32b 2
+#define s_res_icon_tree_32b_dup 3
+#define s_res_icon_tree_32b_wrn 4
+#define s_res_icon_tree_32b_wrn_dup 5
+#define s_res_icon_tree_64b 6
+#define s_res_icon_tree_64b_dup 7
+#define s_res_icon_tree_64b_wrn 8
+#define s_res_icon_tree_64b_wrn_dup 9
+#define s_res_icon_tree_fwd_missing 10
+#define s_res_icon_tree_fwd_invalid 11
+#define s_res_icon_tree_fwd_32b 12
+#define s_res_icon_tree_fwd_32b_dup 13
+#define s_res_icon_tree_fwd_32b_wrn 14
+#define s_res_icon_tree_fwd_32b_wrn_dup 15
+#define s_res_icon_tree_fwd_64b 16
+#define s_res_icon_tree_fwd_64b_dup 17
+#define s_res_icon_tree_fwd_64b_wrn 18
+#define s_res_icon_tree_fwd_64b_wrn_dup 19
+#define s_res_icon_tree_dly_missing 20
+#define s_res_icon_tree_dly_invalid 21
+#define s_res_icon_tree_dly_32b 22 
+#define s_res_icon_tree_dly_32b_dup 23
+#define s_res_icon_tree_dly_32b_wrn 24
+#define s_res_icon_tree_dly_32b_wrn_dup 25
+#define s_res_icon_tree_dly_64b 26
+#define s_res_icon_tree_dly_64b_dup 27
+#define s_res_icon_tree_dly_64b_wrn 28
+#define s_res_icon_tree_dly_64b_wrn_dup 29
+#define s_res_icon_tree_dnm_missing 30
+#define s_res_icon_tree_dnm_invalid 31
+#define s_res_icon_tree_dnm_32b 32
+#define s_res_icon_tree_dnm_32b_dup 33
+#define s_res_icon_tree_dnm_32b_wrn 34
+#define s_res_icon_tree_dnm_32b_wrn_dup 35
+#define s_res_icon_tree_dnm_64b 36
+#define s_res_icon_tree_dnm_64b_dup 37
+#define s_res_icon_tree_dnm_64b_wrn 38
+#define s_res_icon_tree_dnm_64b_wrn_dup 39
+
+
+
+#define s_res_icons_toolbar 3
+
+#define s_res_icon_open 0
+#define s_res_icon_full_paths 4
+#define s_res_icon_undecorate 5
+#define s_res_icon_properties 7
+
+
+
+#define s_res_icons_import_export 4
+
+#define s_res_icon_import_not_found_c 0
+#define s_res_icon_import_not_found_o 2
+#define s_res_icon_import_found_c 6
+#define s_res_icon_import_found_o 8
+
+#define s_res_icon_export0000 29
+#define s_res_icon_export0001 27
+#define s_res_icon_export0010 26
+#define s_res_icon_export0011 24
+//#define s_res_icon_export0100 -1
+//#define s_res_icon_export0101 -1
+//#define s_res_icon_export0110 -1
+//#define s_res_icon_export0111 -1
+#define s_res_icon_export1000 23
+#define s_res_icon_export1001 21
+#define s_res_icon_export1010 20
+#define s_res_icon_export1011 18
+#define s_res_icon_export1100 17
+#define s_res_icon_export1101 15
+#define s_res_icon_export1110 14
+#define s_res_icon_export1111 12
@@ -0,0 +1,3 @@
+template<typename char_t> bool is_ascii(char_t const* const str, int const size){ for(int i=0;i<size;++i) if((unsigned)str[i]>=128) return false; return true;}
+template<typename char_t> char_t to_lowercase(char_t const ch){ return ch>='A'&&ch<='Z'? ch+32:ch;}
+template bool is_ascii<wchar_t>(wchar_t const*, int); template char to_lowercase<char>(char); template wchar_t to_lowercase<wchar_t>(wchar_t);